@@ -29,6 +29,45 @@ typedef enum
     ERROR_FULL_CONTAINER = -6
 } status_t;
 
+/* ===== PLATFORM DETECTION ===== */
+
+/*
+ * @brief Non-zero when x86 SIMD kernels can be compiled (GCC/Clang on x86)
+ *
+ * @note Kernels are built with per-function target attributes, so the library
+ * itself does not need to be compiled with -mavx2 or similar flags
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CSTRUCTS_HAVE_X86_SIMD 1
+#else
+#define CSTRUCTS_HAVE_X86_SIMD 0
+#endif
+
+/*
+ * @brief Copies at least this many bytes bypass the cache with streaming stores
+ *
+ * @note Only used when source and destination do not overlap
+ */
+#define MEM_NONTEMPORAL_THRESHOLD (4 * 1024 * 1024)
+
+/*
+ * @brief Assumed cache line size used to keep concurrently written fields apart
+ *
+ * @note 64 bytes on current x86 and most ARM cores
+ */
+#define CSTRUCTS_CACHE_LINE_SIZE 64
+
+/*
+ * @brief Instruction set levels used to select memory kernels at runtime
+ */
+typedef enum
+{
+    CPU_ISA_SCALAR = 0,
+    CPU_ISA_SSE2 = 1,
+    CPU_ISA_AVX2 = 2,
+    CPU_ISA_AVX512 = 3
+} cpu_isa_t;
+
 /* ===== GENERIC DATA TYPE ===== */
 
 typedef union
@@ -42,6 +81,19 @@ typedef union
         void *ptr_value;
 } data_t;
 
+/*
+ * @brief Fixed-width numeric types, for routines that interpret raw bytes
+ */
+typedef enum
+{
+    DATA_TYPE_INT32,
+    DATA_TYPE_UINT32,
+    DATA_TYPE_INT64,
+    DATA_TYPE_UINT64,
+    DATA_TYPE_FLOAT,
+    DATA_TYPE_DOUBLE
+} data_type_t;
+
 /* ===== MEMORY MANAGEMENT ===== */
 
 /*
@@ -88,6 +140,293 @@ void *mem_realloc(void *ptr, size_t size);
  */
 void mem_free(void **ptr);
 
+/* ===== ALLOCATOR INTERFACE ===== */
+
+/*
+ * @brief Pluggable allocator used by containers for all of their memory
+ *
+ * @note Sizes are passed back on realloc/free so size-class, pool and arena
+ * allocators do not need per-block headers
+ * @note realloc_fn may be NULL; it is then emulated with alloc, copy and free
+ */
+typedef struct
+{
+        void *(*alloc_fn)(void *context, size_t size);
+        void *(*realloc_fn)(void *context, void *ptr, size_t old_size,
+                            size_t new_size);
+        void (*free_fn)(void *context, void *ptr, size_t size);
+        void *context; // User state passed to every callback
+} allocator_t;
+
+/*
+ * @brief Gets the default allocator (mem_alloc/mem_realloc/mem_free)
+ * @return Pointer to a static allocator, never NULL
+ *
+ * @note Time complexity: O(1)
+ */
+const allocator_t *allocator_default(void);
+
+/*
+ * @brief Allocates memory through an allocator
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @param size Number of bytes to allocate
+ * @return Pointer to allocated memory, NULL on failure
+ *
+ * @note Time complexity: depends on the allocator
+ */
+void *allocator_alloc(const allocator_t *allocator, size_t size);
+
+/*
+ * @brief Resizes memory through an allocator
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @param ptr Block to resize (NULL behaves like allocator_alloc)
+ * @param old_size Current size of the block in bytes
+ * @param new_size Requested size in bytes
+ * @return Pointer to resized memory, NULL on failure
+ *
+ * @note Time complexity: O(n) where n is min(old_size, new_size) if data moves
+ * @warning On failure the original block remains valid
+ */
+void *allocator_realloc(const allocator_t *allocator, void *ptr,
+                        size_t old_size, size_t new_size);
+
+/*
+ * @brief Releases memory through an allocator
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @param ptr Block to release (NULL is ignored)
+ * @param size Size of the block in bytes, as passed when it was allocated
+ *
+ * @note Time complexity: depends on the allocator
+ */
+void allocator_free(const allocator_t *allocator, void *ptr, size_t size);
+
+/*
+ * @brief Checks whether two allocators manage the same memory
+ * @param a First allocator (NULL means the default allocator)
+ * @param b Second allocator (NULL means the default allocator)
+ * @return true if callbacks and context match, false otherwise
+ *
+ * @note Time complexity: O(1)
+ * @note Containers can only exchange storage when this returns true
+ */
+bool allocator_equal(const allocator_t *a, const allocator_t *b);
+
+/* ===== ARENA ALLOCATOR ===== */
+
+#define ARENA_DEFAULT_CHUNK_SIZE (64 * 1024)
+#define ARENA_DEFAULT_ALIGNMENT _Alignof(max_align_t)
+
+/*
+ * @brief Chunk of arena memory; allocations are bumped from data[]
+ */
+typedef struct arena_chunk
+{
+        struct arena_chunk *next; // Next chunk (kept for reuse after reset)
+        size_t capacity;          // Usable bytes in data[]
+        size_t used;              // Bytes handed out from this chunk
+        _Alignas(max_align_t) unsigned char data[];
+} arena_chunk_t;
+
+/*
+ * @brief Bump allocator releasing all of its memory at once
+ */
+typedef struct
+{
+        arena_chunk_t *first;   // First chunk in the chain
+        arena_chunk_t *current; // Chunk allocations are bumped from
+        size_t chunk_size;      // Capacity of regular chunks
+        allocator_t backing;    // Allocator the chunks come from
+} arena_t;
+
+/*
+ * @brief Saved arena position for scoped temporaries
+ */
+typedef struct
+{
+        arena_chunk_t *chunk; // Chunk that was current (NULL if none yet)
+        size_t used;          // Bytes used in that chunk
+} arena_mark_t;
+
+/*
+ * @brief Creates a new arena
+ * @param chunk_size Capacity of each chunk (0 selects the default)
+ * @return Pointer to new arena, NULL on failure
+ *
+ * @note Time complexity: O(1)
+ * @note Chunks are allocated lazily on the first allocation
+ */
+arena_t *arena_create(size_t chunk_size);
+
+/*
+ * @brief Creates a new arena whose chunks come from another allocator
+ * @param chunk_size Capacity of each chunk (0 selects the default)
+ * @param backing Allocator for chunks (NULL selects the default allocator)
+ * @return Pointer to new arena, NULL on failure
+ *
+ * @note Time complexity: O(1)
+ */
+arena_t *arena_create_with_allocator(size_t chunk_size,
+                                     const allocator_t *backing);
+
+/*
+ * @brief Destroys an arena, releasing every allocation made from it
+ * @param arena Arena to destroy
+ *
+ * @note Time complexity: O(c) where c is the number of chunks
+ * @warning Pointers obtained from the arena become invalid
+ */
+void arena_destroy(arena_t *arena);
+
+/*
+ * @brief Allocates memory from an arena with default alignment
+ * @param arena Target arena
+ * @param size Number of bytes to allocate
+ * @return Pointer to memory aligned to ARENA_DEFAULT_ALIGNMENT, NULL on failure
+ *
+ * @note Time complexity: O(1) amortized
+ * @note Requests larger than the chunk size get a dedicated chunk
+ */
+void *arena_alloc(arena_t *arena, size_t size);
+
+/*
+ * @brief Allocates memory from an arena with explicit alignment
+ * @param arena Target arena
+ * @param size Number of bytes to allocate
+ * @param alignment Required alignment, a power of two
+ * @return Pointer to aligned memory, NULL on failure
+ *
+ * @note Time complexity: O(1) amortized
+ */
+void *arena_alloc_aligned(arena_t *arena, size_t size, size_t alignment);
+
+/*
+ * @brief Releases every allocation while keeping the chunks for reuse
+ * @param arena Target arena
+ *
+ * @note Time complexity: O(1)
+ * @warning Pointers obtained from the arena become invalid
+ */
+void arena_reset(arena_t *arena);
+
+/*
+ * @brief Records the current arena position
+ * @param arena Target arena
+ * @return Mark to pass to arena_rewind
+ *
+ * @note Time complexity: O(1)
+ */
+arena_mark_t arena_mark(const arena_t *arena);
+
+/*
+ * @brief Releases every allocation made after a mark
+ * @param arena Target arena
+ * @param mark Position obtained from arena_mark on the same arena
+ *
+ * @note Time complexity: O(1)
+ * @note Chunks acquired after the mark are kept for reuse
+ * @warning Marks taken after this one become invalid
+ */
+void arena_rewind(arena_t *arena, arena_mark_t mark);
+
+/*
+ * @brief Gets an allocator_t that allocates from the arena
+ * @param arena Target arena
+ * @return Allocator usable with any *_create_with_allocator function
+ *
+ * @note Time complexity: O(1)
+ * @note Frees are no-ops except for the most recent allocation, which is
+ * returned to the arena; reallocating the most recent block grows it in place
+ */
+allocator_t arena_allocator(arena_t *arena);
+
+/* ===== POOL ALLOCATOR ===== */
+
+#define POOL_SLAB_SIZE 4096     // Target slab size (one page)
+#define POOL_MIN_SLAB_BLOCKS 8 // Slabs hold at least this many blocks
+
+/*
+ * @brief Slab of pool memory, carved into fixed-size blocks
+ */
+typedef struct pool_slab
+{
+        struct pool_slab *next; // Next slab (all slabs are kept until destroy)
+        _Alignas(max_align_t) unsigned char data[];
+} pool_slab_t;
+
+/*
+ * @brief Fixed-size block allocator with an intrusive free list
+ */
+typedef struct
+{
+        void *free_list;         // Released blocks, linked through themselves
+        pool_slab_t *slabs;      // Every slab owned by the pool
+        unsigned char *bump;     // Next never-used block in the newest slab
+        unsigned char *bump_end; // End of the newest slab
+        size_t block_size;       // Block size after alignment rounding
+        size_t blocks_per_slab;  // Blocks carved from each slab
+        allocator_t backing;     // Allocator the slabs come from
+} pool_t;
+
+/*
+ * @brief Creates a new pool of fixed-size blocks
+ * @param block_size Size of each block in bytes
+ * @return Pointer to new pool, NULL on failure
+ *
+ * @note Time complexity: O(1)
+ * @note Blocks are rounded up to ARENA_DEFAULT_ALIGNMENT, like malloc
+ */
+pool_t *pool_create(size_t block_size);
+
+/*
+ * @brief Creates a new pool whose slabs come from another allocator
+ * @param block_size Size of each block in bytes
+ * @param backing Allocator for slabs (NULL selects the default allocator)
+ * @return Pointer to new pool, NULL on failure
+ *
+ * @note Time complexity: O(1)
+ */
+pool_t *pool_create_with_allocator(size_t block_size,
+                                   const allocator_t *backing);
+
+/*
+ * @brief Destroys a pool and releases all of its slabs
+ * @param pool Pool to destroy
+ *
+ * @note Time complexity: O(s) where s is the number of slabs
+ * @warning Blocks obtained from the pool become invalid
+ */
+void pool_destroy(pool_t *pool);
+
+/*
+ * @brief Takes one block from the pool
+ * @param pool Target pool
+ * @return Pointer to an uninitialized block, NULL on failure
+ *
+ * @note Time complexity: O(1); a new slab is allocated only when the free
+ * list and the current slab are exhausted
+ */
+void *pool_alloc(pool_t *pool);
+
+/*
+ * @brief Returns a block to the pool for reuse
+ * @param pool Pool the block came from
+ * @param block Block to release (NULL is ignored)
+ *
+ * @note Time complexity: O(1)
+ * @note Memory goes back to the backing allocator only in pool_destroy
+ */
+void pool_free(pool_t *pool, void *block);
+
+/*
+ * @brief Gets an allocator_t that serves blocks from the pool
+ * @param pool Target pool
+ * @return Allocator usable with any *_create_with_allocator function
+ *
+ * @note Time complexity: O(1)
+ * @warning Requests larger than the block size fail with NULL
+ */
+allocator_t pool_allocator(pool_t *pool);
+
 /* ===== MEMORY OPERATIONS (OUR OWN IMPLEMENTATIONS) ===== */
 
 /*
@@ -98,6 +437,8 @@ void mem_free(void **ptr);
  * @return Pointer to destination
  *
  * @note Time complexity: O(n) where n is count
+ * @note Uses the widest SIMD kernel the CPU supports (see cpu_isa_level)
+ * @note Copies of MEM_NONTEMPORAL_THRESHOLD bytes or more use streaming stores
  * @warning Does not handle overlapping regions; use mem_move for that
  */
 void *mem_copy(void *dest, const void *src, size_t count);
@@ -110,7 +451,8 @@ void *mem_copy(void *dest, const void *src, size_t count);
  * @return Pointer to destination
  *
  * @note Time complexity: O(n) where n is count
- * @note Efficient byte-by-byte setting without alignment assumptions
+ * @note Broadcasts the byte into SIMD registers; large fills use streaming
+ * stores
  */
 void *mem_set(void *dest, int value, size_t count);
 
@@ -123,9 +465,24 @@ void *mem_set(void *dest, int value, size_t count);
  *
  * @note Time complexity: O(n) where n is count
  * @note Returns difference at first mismatch for early termination
+ * @note Compares 16/32 bytes at a time and locates the mismatch via movemask
  */
 int mem_cmp(const void *ptr1, const void *ptr2, size_t count);
 
+/*
+ * @brief Checks two memory regions for equality
+ * @param ptr1 First memory region
+ * @param ptr2 Second memory region
+ * @param count Number of bytes to compare
+ * @return true if both regions hold the same bytes, false otherwise
+ *
+ * @note Time complexity: O(n) where n is count
+ * @note Faster than mem_cmp when ordering is not needed: no mismatch position
+ * is computed, blocks are tested with a single OR-reduction
+ * @warning Returns false if either pointer is NULL
+ */
+bool mem_eq(const void *ptr1, const void *ptr2, size_t count);
+
 /*
  * @brief Copies memory handling overlapping regions (our own memmove)
  * @param dest Destination memory address
@@ -135,9 +492,38 @@ int mem_cmp(const void *ptr1, const void *ptr2, size_t count);
  *
  * @note Time complexity: O(n) where n is count
  * @note Handles overlapping regions correctly by copying direction
+ * @note Shares the SIMD kernel selected for mem_copy
  */
 void *mem_move(void *dest, const void *src, size_t count);
 
+/* ===== CPU FEATURE DETECTION ===== */
+
+/*
+ * @brief Gets the widest instruction set usable on the running CPU
+ * @return Detected ISA level, CPU_ISA_SCALAR on non-x86 builds
+ *
+ * @note Time complexity: O(1)
+ * @note Detected once via cpuid at startup; the memory kernels are selected
+ * from this value before main() runs
+ */
+cpu_isa_t cpu_isa_level(void);
+
+/*
+ * @brief Hints to the CPU that the caller is busy-waiting
+ *
+ * @note Emits pause (x86) or yield (ARM) to save power and free the sibling
+ * hyper-thread; a no-op elsewhere
+ */
+void cpu_relax(void);
+
+/*
+ * @brief Gives up the rest of the thread's time slice
+ *
+ * @note Uses sched_yield on POSIX systems; a no-op elsewhere
+ * @note Used by spin loops once pausing alone has not made progress
+ */
+void thread_yield(void);
+
 /* ===== UTILITY FUNCTIONS ===== */
 
 /*
@@ -147,7 +533,9 @@ void *mem_move(void *dest, const void *src, size_t count);
  * @param size Size of each element in bytes
  *
  * @note Time complexity: O(n) where n is size
- * @note Uses temporary buffer; inefficient for large sizes but safe
+ * @note Never allocates: 4/8/16/32-byte elements are swapped in registers,
+ * larger ones in fixed-size stack chunks
+ * @warning Regions must not partially overlap
  */
 void mem_swap(void *a, void *b, size_t size);
 
@@ -171,6 +559,16 @@ int cmp_max(int a, int b);
  */
 int cmp_min(int a, int b);
 
+/*
+ * @brief Rounds a size up to the next power of two
+ * @param value Value to round
+ * @return Smallest power of two >= value (1 for 0), 0 on overflow
+ *
+ * @note Time complexity: O(log n) bits
+ * @note Used by ring buffers that index with a mask instead of a modulo
+ */
+size_t next_power_of_two(size_t value);
+
 /*
  * @brief Gets the size of a statically allocated array
  * @param array The array
@@ -188,6 +586,15 @@ int cmp_min(int a, int b);
  */
 typedef int (*cmp_fn)(const void *a, const void *b);
 
+/*
+ * @brief Hash function type for hashed containers
+ * @param key Key to hash
+ * @return 64-bit hash; every bit should depend on the whole key
+ *
+ * @note Keys that compare equal must hash equal
+ */
+typedef uint64_t (*hash_fn)(const void *key);
+
 /*
  * @brief Compare function for integers
  *
@@ -217,6 +624,130 @@ int cmp_fn_double(const void *a, const void *b);
  */
 int cmp_fn_string(const void *a, const void *b);
 
+/* ===== HASH FUNCTIONS ===== */
+
+/*
+ * @brief Seed used by the hash_fn_* adapters
+ *
+ * @note With seed 0, hash_bytes produces standard XXH64 values
+ */
+#define HASH_DEFAULT_SEED 0
+
+/*
+ * @brief Streaming hash state (XXH64)
+ *
+ * @note Feeding data in any number of pieces gives the same result as one
+ * hash_bytes call over the concatenation
+ */
+typedef struct
+{
+        uint64_t acc[4];           // Four parallel lane accumulators
+        uint64_t total_length;     // Bytes consumed so far
+        uint64_t seed;             // Seed given to hash_state_init
+        unsigned char buffer[32];  // Partial stripe not yet consumed
+        size_t buffered;           // Bytes held in buffer
+} hash_state_t;
+
+/*
+ * @brief Hashes a byte span (XXH64)
+ * @param data Bytes to hash (may be NULL when length is 0)
+ * @param length Number of bytes
+ * @param seed Seed; different seeds give independent hash functions
+ * @return 64-bit hash
+ *
+ * @note Time complexity: O(n); processes 32-byte stripes in four lanes
+ * @note Not cryptographic: do not use where an attacker picks the keys
+ */
+uint64_t hash_bytes(const void *data, size_t length, uint64_t seed);
+
+/*
+ * @brief Hashes a NUL-terminated string
+ * @param str String to hash (NULL hashes to a fixed value)
+ * @param seed Seed
+ * @return 64-bit hash, equal to hash_bytes over the characters
+ *
+ * @note Time complexity: O(n) where n is string length
+ */
+uint64_t hash_string(const char *str, uint64_t seed);
+
+/*
+ * @brief Mixes a 64-bit integer into a well-distributed hash
+ * @param value Value to mix
+ * @param seed Seed
+ * @return 64-bit hash
+ *
+ * @note Time complexity: O(1); a bijection for a fixed seed
+ */
+uint64_t hash_u64(uint64_t value, uint64_t seed);
+
+/*
+ * @brief Mixes a 32-bit integer into a well-distributed hash
+ * @param value Value to mix
+ * @param seed Seed
+ * @return 32-bit hash
+ *
+ * @note Time complexity: O(1); a bijection for a fixed seed
+ */
+uint32_t hash_u32(uint32_t value, uint32_t seed);
+
+/*
+ * @brief Starts a streaming hash
+ * @param state State to initialize
+ * @param seed Seed
+ */
+void hash_state_init(hash_state_t *state, uint64_t seed);
+
+/*
+ * @brief Feeds more bytes into a streaming hash
+ * @param state Initialized state
+ * @param data Bytes to add (may be NULL when length is 0)
+ * @param length Number of bytes
+ *
+ * @note Time complexity: O(n)
+ */
+void hash_state_update(hash_state_t *state, const void *data, size_t length);
+
+/*
+ * @brief Gets the hash of everything fed so far
+ * @param state Initialized state
+ * @return 64-bit hash
+ *
+ * @note Does not modify the state; more data can still be added
+ */
+uint64_t hash_state_digest(const hash_state_t *state);
+
+/*
+ * @brief Hash function for integers
+ *
+ * @note Time complexity: O(1)
+ * @note Pairs with cmp_fn_int
+ */
+uint64_t hash_fn_int(const void *key);
+
+/*
+ * @brief Hash function for floats
+ *
+ * @note Time complexity: O(1)
+ * @note Pairs with cmp_fn_float: -0.0f and 0.0f hash equal
+ */
+uint64_t hash_fn_float(const void *key);
+
+/*
+ * @brief Hash function for doubles
+ *
+ * @note Time complexity: O(1)
+ * @note Pairs with cmp_fn_double: -0.0 and 0.0 hash equal
+ */
+uint64_t hash_fn_double(const void *key);
+
+/*
+ * @brief Hash function for strings
+ *
+ * @note Time complexity: O(n) where n is string length
+ * @note Pairs with cmp_fn_string: the key is a pointer to a char *
+ */
+uint64_t hash_fn_string(const void *key);
+
 /* ===== DEBUGGING AND ERROR HANDLING ===== */
 
 /*
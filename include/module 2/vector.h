@@ -28,6 +28,7 @@ typedef struct
         size_t size;         // Current number of elements in vector
         size_t capacity;     // Total allocated capacity
         size_t element_size; // Size of each element in bytes
+        allocator_t allocator; // Allocator for the vector and its storage
 } vector_t;
 
 /* ===== VECTOR CREATION AND DESTRUCTION ===== */
@@ -54,6 +55,20 @@ vector_t *vector_create(size_t element_size);
 vector_t *vector_create_with_capacity(size_t element_size,
                                       size_t initial_capacity);
 
+/*
+ * @brief Creates a new vector that allocates through a custom allocator
+ * @param element_size Size of each element in bytes
+ * @param initial_capacity Initial capacity of the vector
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @return Pointer to new vector, NULL on failure
+ *
+ * @note Time complexity: O(1)
+ * @note The allocator is copied; its context must outlive the vector
+ */
+vector_t *vector_create_with_allocator(size_t element_size,
+                                       size_t initial_capacity,
+                                       const allocator_t *allocator);
+
 /*
  * @brief Destroys a vector and frees all associated memory
  * @param vector Pointer to vector to destroy
@@ -70,7 +85,8 @@ void vector_destroy(vector_t *vector);
  * @return New vector with copied data, NULL on failure
  *
  * @note Time complexity: O(n) where n is source size
- * @note Creates deep copy of all elements
+ * @note Creates deep copy of all elements in one bulk copy
+ * @note The copy uses the same allocator as the source
  */
 vector_t *vector_copy(const vector_t *src);
 
@@ -121,6 +137,32 @@ status_t vector_insert(vector_t *vector, size_t index, const void *element);
  */
 status_t vector_remove(vector_t *vector, size_t index);
 
+/*
+ * @brief Removes element at specified index by moving the last one into it
+ * @param vector Target vector
+ * @param index Index of element to remove
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(1)
+ * @warning Does not preserve order: the former last element takes index
+ */
+status_t vector_swap_remove(vector_t *vector, size_t index);
+
+/*
+ * @brief Removes every element matching a predicate
+ * @param vector Target vector
+ * @param pred Returns true for elements to remove
+ * @param context Pointer passed through to pred (can be NULL)
+ * @return Number of elements removed
+ *
+ * @note Time complexity: O(n); pred is called once per element in order
+ * @note Stable: survivors keep their order and are moved in runs, each
+ * run with one bulk move
+ */
+size_t vector_remove_if(vector_t *vector,
+                        bool (*pred)(const void *element, void *context),
+                        void *context);
+
 /*
  * @brief Removes all elements from vector (does not free memory)
  * @param vector Target vector
@@ -130,6 +172,101 @@ status_t vector_remove(vector_t *vector, size_t index);
  */
 void vector_clear(vector_t *vector);
 
+/* ===== BULK OPERATIONS ===== */
+
+/*
+ * @brief Appends an array of elements to the end of the vector
+ * @param vector Target vector
+ * @param elements Contiguous elements to append (can be NULL if count is 0)
+ * @param count Number of elements
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(count) amortized
+ * @note One capacity check and one bulk copy for the whole batch
+ * @warning elements must not point into the vector's own storage
+ */
+status_t vector_append_n(vector_t *vector, const void *elements,
+                         size_t count);
+
+/*
+ * @brief Inserts an array of elements at specified index
+ * @param vector Target vector
+ * @param index Index where the first new element goes (may equal size)
+ * @param elements Contiguous elements to insert (can be NULL if count is 0)
+ * @param count Number of elements
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(count + n - index)
+ * @note The tail is shifted once, not once per element
+ * @warning elements must not point into the vector's own storage
+ */
+status_t vector_insert_range(vector_t *vector, size_t index,
+                             const void *elements, size_t count);
+
+/*
+ * @brief Removes a run of consecutive elements
+ * @param vector Target vector
+ * @param index Index of the first element to remove
+ * @param count Number of elements to remove
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(n - index - count)
+ * @note The tail is shifted once, not once per element
+ */
+status_t vector_erase_range(vector_t *vector, size_t index, size_t count);
+
+/*
+ * @brief Replaces the contents of the vector with an array
+ * @param vector Target vector
+ * @param elements Contiguous elements to copy (can be NULL if count is 0)
+ * @param count Number of elements
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(count)
+ * @note Keeps the existing storage when it is large enough; on failure the
+ * vector is left unchanged
+ * @warning elements must not point into the vector's own storage
+ */
+status_t vector_assign(vector_t *vector, const void *elements, size_t count);
+
+/* ===== IN-PLACE CONSTRUCTION ===== */
+
+/*
+ * @brief Appends an uninitialized element and returns a pointer to it
+ * @param vector Target vector
+ * @return Pointer to the new last element, NULL on failure
+ *
+ * @note Time complexity: O(1) amortized
+ * @note Build the element directly in the vector instead of copying it in
+ * from a caller buffer
+ * @warning The pointer becomes invalid when the vector grows; the element's
+ * bytes are indeterminate until written
+ */
+void *vector_emplace_back(vector_t *vector);
+
+/*
+ * @brief Makes room for elements past the end without adding them
+ * @param vector Target vector
+ * @param count Number of slots needed
+ * @return Pointer to the first of count unused slots, NULL on failure
+ *
+ * @note Time complexity: O(1) amortized per slot
+ * @note Fill any prefix of the slots (with read(), a parser, ...), then
+ * publish it with vector_commit
+ * @warning The pointer becomes invalid when the vector grows
+ */
+void *vector_reserve_tail(vector_t *vector, size_t count);
+
+/*
+ * @brief Adds slots filled after vector_reserve_tail to the vector
+ * @param vector Target vector
+ * @param count Number of slots to add; at most capacity - size
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(1)
+ */
+status_t vector_commit(vector_t *vector, size_t count);
+
 /* ===== ELEMENT ACCESS ===== */
 
 /*
@@ -278,9 +415,278 @@ bool vector_contains(const vector_t *vector, const void *element, cmp_fn cmp);
  *
  * @note Time complexity: O(1)
  * @note Efficient pointer swapping without data copying
+ * @warning Does nothing if the vectors use different allocators
  */
 void vector_swap(vector_t *a, vector_t *b);
 
+/* ===== SORTING ===== */
+
+/*
+ * @brief Sorts the vector in place
+ * @param vector Target vector
+ * @param cmp Comparison function
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(n log n) worst case
+ * @note Introsort: median-of-three quicksort that falls back to heapsort
+ * when recursion gets too deep, with insertion sort for short ranges
+ * @note 4, 8 and 16-byte elements are swapped in registers
+ * @warning Not stable: equal elements may be reordered
+ */
+status_t vector_sort(vector_t *vector, cmp_fn cmp);
+
+/*
+ * @brief Sorts the vector in place by a numeric key inside each element
+ * @param vector Target vector
+ * @param key_type Type of the key
+ * @param key_offset Byte offset of the key inside each element
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(n * k) where k is the key width in bytes
+ * @note LSD radix sort, one byte per pass; all histograms are built in a
+ * single read, and passes whose byte is the same for every key are skipped
+ * @note Stable. Floats order as numbers: -0 before +0, and NaNs at the
+ * ends according to their sign bit
+ * @note Uses a scratch buffer the size of the vector's storage
+ */
+status_t vector_sort_radix(vector_t *vector, data_type_t key_type,
+                           size_t key_offset);
+
+/*
+ * @brief Sorts the vector in place using several threads
+ * @param vector Target vector
+ * @param cmp Comparison function; must be safe to call concurrently
+ * @param nthreads Number of threads to use (0 uses every online CPU)
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O((n log n) / p + n log p) with p threads
+ * @note Each thread introsorts one slice, then log2(p) rounds merge runs in
+ * pairs. Every round splits the output evenly between all threads by merge
+ * path, so the merges stay parallel to the end
+ * @note Uses a scratch buffer the size of the vector's storage. Falls back
+ * to vector_sort for small vectors or where POSIX threads are unavailable
+ * @warning Not stable: equal elements may be reordered
+ */
+status_t vector_sort_parallel(vector_t *vector, cmp_fn cmp, size_t nthreads);
+
+/* ===== SORTED VECTOR OPERATIONS ===== */
+
+/*
+ * @brief Finds the first element that does not sort before key
+ * @param vector Target vector, sorted by cmp
+ * @param key Key to look for
+ * @param cmp Comparison function
+ * @return Index of that element, size if every element sorts before key,
+ * 0 on invalid input
+ *
+ * @note Time complexity: O(log n)
+ */
+size_t vector_lower_bound(const vector_t *vector, const void *key,
+                          cmp_fn cmp);
+
+/*
+ * @brief Finds the first element that sorts after key
+ * @param vector Target vector, sorted by cmp
+ * @param key Key to look for
+ * @param cmp Comparison function
+ * @return Index of that element, size if none does, 0 on invalid input
+ *
+ * @note Time complexity: O(log n)
+ * @note [lower_bound, upper_bound) spans every element equal to key
+ */
+size_t vector_upper_bound(const vector_t *vector, const void *key,
+                          cmp_fn cmp);
+
+/*
+ * @brief Finds an element in a sorted vector
+ * @param vector Target vector, sorted by cmp
+ * @param key Key to look for
+ * @param cmp Comparison function
+ * @return Index of the first element equal to key, -1 if not found
+ *
+ * @note Time complexity: O(log n); use instead of vector_find on sorted data
+ */
+int vector_binary_search(const vector_t *vector, const void *key,
+                         cmp_fn cmp);
+
+/*
+ * @brief Merges two sorted vectors
+ * @param dest Output vector; its contents are replaced (kept on failure)
+ * @param a First sorted input
+ * @param b Second sorted input
+ * @param cmp Comparison function
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(n + m) element copies, and
+ * O(min(n, m) log(max(n, m) / min(n, m))) comparisons when one input is
+ * much smaller or the inputs interleave in long runs
+ * @note Stable: of equal elements, those from a come first
+ * @note Galloping: each step finds the end of the current run by
+ * exponential search and copies the run in bulk
+ * @warning dest must not be a or b; all three share one element size
+ */
+status_t vector_merge(vector_t *dest, const vector_t *a, const vector_t *b,
+                      cmp_fn cmp);
+
+/*
+ * @brief Computes the sorted union of two sorted vectors
+ * @param dest Output vector; its contents are replaced (kept on failure)
+ * @param a First sorted input
+ * @param b Second sorted input
+ * @param cmp Comparison function
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: as vector_merge
+ * @note An element equal in both inputs is taken once, from a; duplicates
+ * within an input appear max(count in a, count in b) times
+ * @warning dest must not be a or b; all three share one element size
+ */
+status_t vector_set_union(vector_t *dest, const vector_t *a,
+                          const vector_t *b, cmp_fn cmp);
+
+/*
+ * @brief Computes the sorted intersection of two sorted vectors
+ * @param dest Output vector; its contents are replaced (kept on failure)
+ * @param a First sorted input
+ * @param b Second sorted input
+ * @param cmp Comparison function
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(min(n, m) log(max(n, m) / min(n, m))) comparisons
+ * @note Elements are taken from a, min(count in a, count in b) times each
+ * @warning dest must not be a or b; all three share one element size
+ */
+status_t vector_set_intersection(vector_t *dest, const vector_t *a,
+                                 const vector_t *b, cmp_fn cmp);
+
+/*
+ * @brief Computes the elements of one sorted vector missing from another
+ * @param dest Output vector; its contents are replaced (kept on failure)
+ * @param a Sorted input to take elements from
+ * @param b Sorted input of elements to leave out
+ * @param cmp Comparison function
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: as vector_merge
+ * @note Each element of b cancels at most one equal element of a
+ * @warning dest must not be a or b; all three share one element size
+ */
+status_t vector_set_difference(vector_t *dest, const vector_t *a,
+                               const vector_t *b, cmp_fn cmp);
+
+/* ===== NUMERIC OPERATIONS ===== */
+
+/*
+ * These treat the vector as an array of one numeric type and run SIMD
+ * kernels chosen at runtime (see cpu_isa_level): AVX2 where available,
+ * portable loops otherwise. Values and results travel in the data_t member
+ * of the element's width: int_value for 32-bit integers, long_value for
+ * 64-bit integers, float_value and double_value for floating point.
+ * Unsigned types use the signed member of the same width, reinterpreted.
+ * Every function fails (or finds nothing) when the vector's element size
+ * does not match the type.
+ */
+
+/*
+ * @brief Finds the first element equal to a value
+ * @param vector Target vector of numeric elements
+ * @param type Element type
+ * @param value Value to find, in the member matching type
+ * @return Index of element if found, -1 if not found
+ *
+ * @note Time complexity: O(n) where n is vector size
+ * @note Compares a whole register of elements per step instead of calling
+ * a cmp_fn per element as vector_find does
+ * @note Floats compare as numbers: -0 equals +0 and NaN equals nothing
+ */
+int vector_find_eq(const vector_t *vector, data_type_t type, data_t value);
+
+/*
+ * @brief Counts the elements equal to a value
+ * @param vector Target vector of numeric elements
+ * @param type Element type
+ * @param value Value to count, in the member matching type
+ * @return Number of equal elements, 0 on invalid input
+ *
+ * @note Time complexity: O(n) where n is vector size
+ */
+size_t vector_count_eq(const vector_t *vector, data_type_t type,
+                       data_t value);
+
+/*
+ * @brief Gets the smallest element
+ * @param vector Target vector of numeric elements
+ * @param type Element type
+ * @param result Where to store the value, in the member matching type
+ * @return SUCCESS on success, ERROR_EMPTY_CONTAINER if empty, error code on
+ * failure
+ *
+ * @note Time complexity: O(n) where n is vector size
+ * @warning The result is unspecified if the vector holds NaNs
+ */
+status_t vector_min(const vector_t *vector, data_type_t type, data_t *result);
+
+/*
+ * @brief Gets the largest element
+ * @param vector Target vector of numeric elements
+ * @param type Element type
+ * @param result Where to store the value, in the member matching type
+ * @return SUCCESS on success, ERROR_EMPTY_CONTAINER if empty, error code on
+ * failure
+ *
+ * @note Time complexity: O(n) where n is vector size
+ * @warning The result is unspecified if the vector holds NaNs
+ */
+status_t vector_max(const vector_t *vector, data_type_t type, data_t *result);
+
+/*
+ * @brief Adds up all elements
+ * @param vector Target vector of numeric elements
+ * @param type Element type
+ * @param result Where to store the sum: long_value for integer types,
+ * double_value for float and double
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(n) where n is vector size
+ * @note Integer sums are 64 bits wide and wrap on overflow; float elements
+ * are accumulated in double. An empty vector sums to 0
+ * @note Elements are added in lane order, so floating point sums may differ
+ * in the last bits from a sequential loop and between CPUs
+ */
+status_t vector_sum(const vector_t *vector, data_type_t type, data_t *result);
+
+/*
+ * @brief Finds the index of the smallest element
+ * @param vector Target vector of numeric elements
+ * @param type Element type
+ * @param index Where to store the index of the first smallest element
+ * @return SUCCESS on success, ERROR_EMPTY_CONTAINER if empty, error code on
+ * failure
+ *
+ * @note Time complexity: O(n) where n is vector size
+ * @note Reads the data once
+ * @warning If the vector holds NaNs, which element is chosen is unspecified
+ * (it may be a NaN), but the index is always below the vector's size
+ */
+status_t vector_argmin(const vector_t *vector, data_type_t type,
+                       size_t *index);
+
+/*
+ * @brief Finds the index of the largest element
+ * @param vector Target vector of numeric elements
+ * @param type Element type
+ * @param index Where to store the index of the first largest element
+ * @return SUCCESS on success, ERROR_EMPTY_CONTAINER if empty, error code on
+ * failure
+ *
+ * @note Time complexity: O(n) where n is vector size
+ * @note Reads the data once
+ * @warning If the vector holds NaNs, which element is chosen is unspecified
+ * (it may be a NaN), but the index is always below the vector's size
+ */
+status_t vector_argmax(const vector_t *vector, data_type_t type,
+                       size_t *index);
+
 /* ===== ITERATION ===== */
 
 /*
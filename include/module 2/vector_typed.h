@@ -0,0 +1,171 @@
+/*
+ * @file vector_typed.h
+ * @brief Typed Accessors for the Dynamic Vector
+ * @author Rodrigo Martins
+ * @version 0.0
+ * @date 2024
+ *
+ * CStructs+ Library - Vector Module
+ * Generates type-specific inline functions over vector_t
+ *
+ * Usage:
+ *     CSTRUCTS_VECTOR_DEFINE(ints, int)
+ *
+ *     vector_t *v = ints_create();
+ *     ints_push(v, 42);
+ *     int index = ints_find(v, 42);
+ *
+ * The generated functions work on an ordinary vector_t, so the generic
+ * vector_* API (sorting, bulk operations, ...) still applies to it. Because
+ * the element type is known at compile time, element access is a plain
+ * array index and find compares values directly instead of calling a
+ * cmp_fn per element, which lets the compiler inline and vectorize loops.
+ */
+
+#ifndef CSTRUCTS_VECTOR_TYPED_H
+#define CSTRUCTS_VECTOR_TYPED_H
+
+#include "vector.h"
+#include <stdbool.h>
+
+/*
+ * @brief Equality used by CSTRUCTS_VECTOR_DEFINE
+ *
+ * @note Only valid for arithmetic and pointer types
+ */
+#define CSTRUCTS_VECTOR_EQ_DEFAULT(a, b) ((a) == (b))
+
+/*
+ * @brief Defines typed vector functions for an element type with ==
+ * @param name Prefix of the generated functions
+ * @param T Element type (arithmetic or pointer)
+ *
+ * @note For structs and other types without ==, use
+ * CSTRUCTS_VECTOR_DEFINE_WITH_EQ
+ */
+#define CSTRUCTS_VECTOR_DEFINE(name, T) \
+    CSTRUCTS_VECTOR_DEFINE_WITH_EQ(name, T, CSTRUCTS_VECTOR_EQ_DEFAULT)
+
+/*
+ * @brief Defines typed vector functions with a custom equality
+ * @param name Prefix of the generated functions
+ * @param T Element type
+ * @param eq Function or function-like macro taking two T values and
+ * returning non-zero when they are equal
+ *
+ * Generated functions (all static inline):
+ *     vector_t *name_create(void)
+ *     vector_t *name_create_with_capacity(size_t capacity)
+ *     T *name_data(vector_t *vector)
+ *     size_t name_size(const vector_t *vector)
+ *     status_t name_push(vector_t *vector, T value)
+ *     status_t name_pop(vector_t *vector, T *output)
+ *     status_t name_append(vector_t *vector, const T *values, size_t count)
+ *     T *name_at(vector_t *vector, size_t index)
+ *     status_t name_get(const vector_t *vector, size_t index, T *output)
+ *     status_t name_set(vector_t *vector, size_t index, T value)
+ *     int name_find(const vector_t *vector, T value)
+ *     bool name_contains(const vector_t *vector, T value)
+ *
+ * @warning The vector's element_size must be sizeof(T); create it with
+ * name_create or name_create_with_capacity
+ */
+#define CSTRUCTS_VECTOR_DEFINE_WITH_EQ(name, T, eq)                           \
+    static inline vector_t *name##_create(void)                               \
+    {                                                                         \
+        return vector_create(sizeof(T));                                      \
+    }                                                                         \
+                                                                              \
+    static inline vector_t *name##_create_with_capacity(size_t capacity)      \
+    {                                                                         \
+        return vector_create_with_capacity(sizeof(T), capacity);              \
+    }                                                                         \
+                                                                              \
+    static inline T *name##_data(vector_t *vector)                            \
+    {                                                                         \
+        return (T *)vector->data;                                             \
+    }                                                                         \
+                                                                              \
+    static inline size_t name##_size(const vector_t *vector)                  \
+    {                                                                         \
+        return vector->size;                                                  \
+    }                                                                         \
+                                                                              \
+    /* Stores in place while there is room; grows through vector_push_back */ \
+    static inline status_t name##_push(vector_t *vector, T value)             \
+    {                                                                         \
+        if (vector->size < vector->capacity)                                  \
+        {                                                                     \
+            ((T *)vector->data)[vector->size++] = value;                      \
+            return SUCCESS;                                                   \
+        }                                                                     \
+        return vector_push_back(vector, &value);                              \
+    }                                                                         \
+                                                                              \
+    static inline status_t name##_pop(vector_t *vector, T *output)            \
+    {                                                                         \
+        if (vector->size == 0)                                                \
+        {                                                                     \
+            return ERROR_EMPTY_CONTAINER;                                     \
+        }                                                                     \
+        vector->size--;                                                       \
+        if (output != NULL)                                                   \
+        {                                                                     \
+            *output = ((T *)vector->data)[vector->size];                      \
+        }                                                                     \
+        return SUCCESS;                                                       \
+    }                                                                         \
+                                                                              \
+    static inline status_t name##_append(vector_t *vector, const T *values,   \
+                                         size_t count)                        \
+    {                                                                         \
+        return vector_append_n(vector, values, count);                        \
+    }                                                                         \
+                                                                              \
+    /* Unchecked: index must be below size */                                 \
+    static inline T *name##_at(vector_t *vector, size_t index)                \
+    {                                                                         \
+        return (T *)vector->data + index;                                     \
+    }                                                                         \
+                                                                              \
+    static inline status_t name##_get(const vector_t *vector, size_t index,   \
+                                      T *output)                              \
+    {                                                                         \
+        if (index >= vector->size)                                            \
+        {                                                                     \
+            return ERROR_INDEX_OUT_OF_BOUNDS;                                 \
+        }                                                                     \
+        *output = ((const T *)vector->data)[index];                           \
+        return SUCCESS;                                                       \
+    }                                                                         \
+                                                                              \
+    static inline status_t name##_set(vector_t *vector, size_t index,         \
+                                      T value)                                \
+    {                                                                         \
+        if (index >= vector->size)                                            \
+        {                                                                     \
+            return ERROR_INDEX_OUT_OF_BOUNDS;                                 \
+        }                                                                     \
+        ((T *)vector->data)[index] = value;                                   \
+        return SUCCESS;                                                       \
+    }                                                                         \
+                                                                              \
+    static inline int name##_find(const vector_t *vector, T value)            \
+    {                                                                         \
+        const T *data = (const T *)vector->data;                              \
+        for (size_t i = 0; i < vector->size; i++)                             \
+        {                                                                     \
+            if (eq(data[i], value))                                           \
+            {                                                                 \
+                return (int)i;                                                \
+            }                                                                 \
+        }                                                                     \
+        return -1;                                                            \
+    }                                                                         \
+                                                                              \
+    static inline bool name##_contains(const vector_t *vector, T value)       \
+    {                                                                         \
+        return name##_find(vector, value) >= 0;                               \
+    }
+
+#endif /* CSTRUCTS_VECTOR_TYPED_H */
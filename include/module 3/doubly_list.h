@@ -17,11 +17,16 @@
 
 /* ===== NODE STRUCTURE ===== */
 
+/*
+ * @brief List node with the element stored inline after the links
+ *
+ * @note One allocation per node; data is aligned like malloc'd memory
+ */
 typedef struct doubly_node
 {
-        void *data;               // Pointer to node data
         struct doubly_node *next; // Pointer to next node
         struct doubly_node *prev; // Pointer to previous node
+        _Alignas(max_align_t) unsigned char data[]; // Element bytes
 } doubly_node_t;
 
 /* ===== LIST STRUCTURE ===== */
@@ -32,6 +37,9 @@ typedef struct
         doubly_node_t *tail; // Last node in list
         size_t size;         // Number of elements in list
         size_t element_size; // Size of each element in bytes
+        allocator_t allocator; // Allocator backing the list and its pool
+        pool_t *node_pool;     // Recycled nodes (header + inline element)
+        bool owns_pool;        // False when node_pool is shared
 } doubly_list_t;
 
 /* ===== LIST CREATION AND DESTRUCTION ===== */
@@ -43,9 +51,42 @@ typedef struct
  *
  * @note Time complexity: O(1)
  * @note Uses both head and tail pointers for bidirectional operations
+ * @note Nodes are recycled through a per-list slab pool
  */
 doubly_list_t *doubly_list_create(size_t element_size);
 
+/*
+ * @brief Creates a new doubly linked list that allocates through a custom
+ * allocator
+ * @param element_size Size of each element in bytes
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @return Pointer to new list, NULL on failure
+ *
+ * @note Time complexity: O(1)
+ * @note The allocator is copied; its context must outlive the list
+ * @note Nodes come from a slab pool on top of the allocator, so push/pop
+ * churn recycles memory instead of calling it
+ */
+doubly_list_t *doubly_list_create_with_allocator(size_t element_size,
+                                                 const allocator_t *allocator);
+
+/*
+ * @brief Creates a new doubly linked list whose nodes come from a shared pool
+ * @param element_size Size of each element in bytes
+ * @param pool Pool to take nodes from; blocks must hold at least
+ * sizeof(doubly_node_t) + element_size bytes
+ * @return Pointer to new list, NULL on failure
+ *
+ * @note Time complexity: O(1)
+ * @note Lists sharing a pool can pass nodes to each other with
+ * doubly_list_move_node_back and doubly_list_splice_back, without copying
+ * @note The list structure comes from the pool's backing allocator
+ * @warning The pool must outlive the list; destroying the list returns its
+ * nodes to the pool but leaves the pool itself alone
+ */
+doubly_list_t *doubly_list_create_with_pool(size_t element_size,
+                                            pool_t *pool);
+
 /*
  * @brief Destroys a doubly linked list and frees all associated memory
  * @param list Pointer to list to destroy
@@ -62,6 +103,7 @@ void doubly_list_destroy(doubly_list_t *list);
  *
  * @note Time complexity: O(n) where n is source size
  * @note Creates deep copy of all elements
+ * @note The copy uses the same allocator as the source
  */
 doubly_list_t *doubly_list_copy(const doubly_list_t *src);
 
@@ -134,6 +176,9 @@ status_t doubly_list_remove(doubly_list_t *list, size_t index);
 /*
  * @brief Removes all elements from list (does not free list structure)
  * @param list Target list
+ *
+ * @note Returns all nodes to the list's pool for reuse; their memory is
+ * released by doubly_list_destroy
  */
 void doubly_list_clear(doubly_list_t *list);
 
@@ -265,6 +310,59 @@ status_t doubly_list_insert_before(doubly_list_t *list, doubly_node_t *node,
 status_t doubly_list_insert_after(doubly_list_t *list, doubly_node_t *node,
                                   const void *element);
 
+/* ===== NODE OPERATIONS ===== */
+
+/*
+ * @brief Appends an element and returns the node that holds it
+ * @param list Target list
+ * @param element Element to append, or NULL to leave the node's data
+ * uninitialized for the caller to fill in
+ * @return The new tail node, NULL on failure
+ *
+ * @note Time complexity: O(1)
+ * @note The node stays valid until it is removed, so it can serve as a
+ * handle for doubly_list_erase_node and doubly_list_move_node_back
+ */
+doubly_node_t *doubly_list_push_back_node(doubly_list_t *list,
+                                          const void *element);
+
+/*
+ * @brief Removes a node given a pointer to it
+ * @param list List that holds the node
+ * @param node Node to remove
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(1); no index walk
+ * @warning node must belong to list
+ */
+status_t doubly_list_erase_node(doubly_list_t *list, doubly_node_t *node);
+
+/*
+ * @brief Moves a node from one list to the end of another
+ * @param dest Destination list
+ * @param src List that holds the node
+ * @param node Node to move
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(1); the element is not copied and the node
+ * keeps its address
+ * @note dest and src may be the same list
+ * @warning Both lists must share one node pool; node must belong to src
+ */
+status_t doubly_list_move_node_back(doubly_list_t *dest, doubly_list_t *src,
+                                    doubly_node_t *node);
+
+/*
+ * @brief Moves every node of one list to the end of another
+ * @param dest Destination list
+ * @param src Source list, left empty
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(1)
+ * @warning Both lists must share one node pool
+ */
+status_t doubly_list_splice_back(doubly_list_t *dest, doubly_list_t *src);
+
 /* ===== UTILITY OPERATIONS ===== */
 
 /*
@@ -284,6 +382,7 @@ status_t doubly_list_reverse(doubly_list_t *list);
  *
  * @note Time complexity: O(1)
  * @note Efficient pointer swapping without data copying
+ * @warning Does nothing if the lists use different allocators
  */
 void doubly_list_swap(doubly_list_t *a, doubly_list_t *b);
 
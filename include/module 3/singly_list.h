@@ -17,10 +17,15 @@
 
 /* ===== NODE STRUCTURE ===== */
 
+/*
+ * @brief List node with the element stored inline after the link
+ *
+ * @note One allocation per node; data is aligned like malloc'd memory
+ */
 typedef struct singly_node
 {
-        void *data;               // Pointer to node data
         struct singly_node *next; // Pointer to next node
+        _Alignas(max_align_t) unsigned char data[]; // Element bytes
 } singly_node_t;
 
 /* ===== LIST STRUCTURE ===== */
@@ -31,6 +36,8 @@ typedef struct
         singly_node_t *tail; // Last node in list (for O(1) append)
         size_t size;         // Number of elements in list
         size_t element_size; // Size of each element in bytes
+        allocator_t allocator; // Allocator backing the list and its pool
+        pool_t *node_pool;     // Recycled nodes (header + inline element)
 } singly_list_t;
 
 /* ===== LIST CREATION AND DESTRUCTION ===== */
@@ -42,9 +49,25 @@ typedef struct
  *
  * @note Time complexity: O(1)
  * @note Uses tail pointer for O(1) append operations
+ * @note Nodes are recycled through a per-list slab pool
  */
 singly_list_t *singly_list_create(size_t element_size);
 
+/*
+ * @brief Creates a new singly linked list that allocates through a custom
+ * allocator
+ * @param element_size Size of each element in bytes
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @return Pointer to new list, NULL on failure
+ *
+ * @note Time complexity: O(1)
+ * @note The allocator is copied; its context must outlive the list
+ * @note Nodes come from a slab pool on top of the allocator, so push/pop
+ * churn recycles memory instead of calling it
+ */
+singly_list_t *singly_list_create_with_allocator(size_t element_size,
+                                                 const allocator_t *allocator);
+
 /*
  * @brief Destroys a singly linked list and frees all associated memory
  * @param list Pointer to list to destroy
@@ -61,6 +84,7 @@ void singly_list_destroy(singly_list_t *list);
  *
  * @note Time complexity: O(n) where n is source size
  * @note Creates deep copy of all elements
+ * @note The copy uses the same allocator as the source
  */
 singly_list_t *singly_list_copy(const singly_list_t *src);
 
@@ -139,7 +163,8 @@ status_t singly_list_remove(singly_list_t *list, size_t index);
  * @param list Target list
  *
  * @note Time complexity: O(n) where n is list size
- * @note Frees all nodes but retains list structure
+ * @note Returns all nodes to the list's pool for reuse; their memory is
+ * released by singly_list_destroy
  */
 void singly_list_clear(singly_list_t *list);
 
@@ -266,6 +291,7 @@ status_t singly_list_reverse(singly_list_t *list);
  *
  * @note Time complexity: O(1)
  * @note Efficient pointer swapping without data copying
+ * @warning Does nothing if the lists use different allocators
  */
 void singly_list_swap(singly_list_t *a, singly_list_t *b);
 
@@ -6,26 +6,71 @@
  * @date 2024
  *
  * CStructs+ Library - Deque Module
- * Provides deque implementation using doubly linked list
+ * Provides deque implementation using a growable circular buffer, plus a
+ * Chase-Lev work-stealing deque for schedulers
  */
 
 #ifndef CSTRUCTS_DEQUE_H
 #define CSTRUCTS_DEQUE_H
 
 #include "../module 1/core.h"
-#include "../module 3/doubly_list.h"
+#include <stdatomic.h>
 #include <stdbool.h>
 
-/* ===== DEQUE USING DOUBLY LINKED LIST ===== */
+/* ===== DEQUE USING CIRCULAR BUFFER ===== */
 
 /*
- * @brief Deque implemented using doubly linked list
+ * @brief Deque implemented using a power-of-two circular buffer
+ *
+ * @note Logical index i lives in slot (head + i) & (capacity - 1)
  */
 typedef struct
 {
-        doubly_list_t *list; // Using doubly linked list as underlying storage
+        void *data;          // Pointer to circular element buffer
+        size_t head;         // Slot holding the front element
+        size_t size;         // Current number of elements
+        size_t capacity;     // Number of slots (always a power of two)
+        size_t element_size; // Size of each element
+        allocator_t allocator; // Allocator for the deque and its buffer
 } deque_t;
 
+/* ===== WORK-STEALING DEQUE (CHASE-LEV) ===== */
+
+/*
+ * @brief Circular slot array of a work-stealing deque
+ *
+ * @note Arrays replaced by growth stay linked through retired until the
+ * deque is destroyed, because a thief may still be reading from them
+ */
+typedef struct deque_ws_array
+{
+        size_t mask;                    // Capacity - 1 (power of two)
+        struct deque_ws_array *retired; // Array this one replaced
+        _Alignas(max_align_t) unsigned char data[]; // Element slots
+} deque_ws_array_t;
+
+/*
+ * @brief Chase-Lev work-stealing deque
+ *
+ * @note The owner thread pushes and pops at the bottom without locks;
+ * any other thread may steal from the top with a single CAS
+ * @note Padding keeps top (thieves) and bottom (owner) on separate cache
+ * lines
+ */
+typedef struct
+{
+        _Atomic(deque_ws_array_t *) array; // Current slot array
+        size_t element_size;               // Size of each element
+        allocator_t allocator; // Allocator for the deque and its arrays
+        char pad_config[CSTRUCTS_CACHE_LINE_SIZE];
+
+        atomic_intptr_t top; // Next index to steal (advanced by CAS)
+        char pad_top[CSTRUCTS_CACHE_LINE_SIZE];
+
+        atomic_intptr_t bottom; // Next index to push (owner only)
+        char pad_bottom[CSTRUCTS_CACHE_LINE_SIZE];
+} deque_ws_t;
+
 /* ===== DEQUE OPERATIONS ===== */
 
 /*
@@ -33,17 +78,38 @@ typedef struct
  * @param element_size Size of each element in bytes
  * @return Pointer to new deque, NULL on failure
  *
- * @note Uses doubly linked list for O(1) operations at both ends
- * @note No capacity limits, flexible insertion/removal anywhere
+ * @note Amortized O(1) operations at both ends, O(1) random access
+ * @note Buffer doubles when full, so there is no capacity limit
  */
 deque_t *deque_create(size_t element_size);
 
+/*
+ * @brief Creates a new deque with specified initial capacity
+ * @param element_size Size of each element in bytes
+ * @param capacity Initial capacity, rounded up to a power of two
+ * @return Pointer to new deque, NULL on failure
+ *
+ * @note Pre-sizing avoids regrowth when the element count is known
+ */
+deque_t *deque_create_with_capacity(size_t element_size, size_t capacity);
+
+/*
+ * @brief Creates a new deque that allocates through a custom allocator
+ * @param element_size Size of each element in bytes
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @return Pointer to new deque, NULL on failure
+ *
+ * @note The deque structure and its buffer come from the allocator
+ */
+deque_t *deque_create_with_allocator(size_t element_size,
+                                     const allocator_t *allocator);
+
 /*
  * @brief Destroys a deque and frees all memory
  * @param deque Pointer to deque to destroy
  *
  * @note Safely handles NULL pointers
- * @note Frees all nodes and the deque structure
+ * @note Frees the buffer and the deque structure
  */
 void deque_destroy(deque_t *deque);
 
@@ -53,8 +119,7 @@ void deque_destroy(deque_t *deque);
  * @param element Element to push
  * @return SUCCESS on success, error code on failure
  *
- * @note Time complexity: O(1)
- * @note Efficient front insertion using doubly linked list
+ * @note Time complexity: O(1) amortized
  */
 status_t deque_push_front(deque_t *deque, const void *element);
 
@@ -64,8 +129,7 @@ status_t deque_push_front(deque_t *deque, const void *element);
  * @param element Element to push
  * @return SUCCESS on success, error code on failure
  *
- * @note Time complexity: O(1)
- * @note Efficient back insertion using doubly linked list
+ * @note Time complexity: O(1) amortized
  */
 status_t deque_push_back(deque_t *deque, const void *element);
 
@@ -76,7 +140,6 @@ status_t deque_push_back(deque_t *deque, const void *element);
  * @return SUCCESS on success, error code on failure
  *
  * @note Time complexity: O(1)
- * @note Efficient front removal using doubly linked list
  */
 status_t deque_pop_front(deque_t *deque, void *output);
 
@@ -87,7 +150,6 @@ status_t deque_pop_front(deque_t *deque, void *output);
  * @return SUCCESS on success, error code on failure
  *
  * @note Time complexity: O(1)
- * @note Efficient back removal using doubly linked list
  */
 status_t deque_pop_back(deque_t *deque, void *output);
 
@@ -158,8 +220,8 @@ bool deque_empty(const deque_t *deque);
  * @param element Element to insert
  * @return SUCCESS on success, error code on failure
  *
- * @note Time complexity: O(n) in worst case, O(1) at ends
- * @note Supports insertion at any position in the deque
+ * @note Time complexity: O(min(index, size - index))
+ * @note Shifts whichever side of the index holds fewer elements
  */
 status_t deque_insert(deque_t *deque, size_t index, const void *element);
 
@@ -169,8 +231,8 @@ status_t deque_insert(deque_t *deque, size_t index, const void *element);
  * @param index Index of element to remove
  * @return SUCCESS on success, error code on failure
  *
- * @note Time complexity: O(n) in worst case, O(1) at ends
- * @note Supports removal from any position in the deque
+ * @note Time complexity: O(min(index, size - index))
+ * @note Shifts whichever side of the index holds fewer elements
  */
 status_t deque_remove(deque_t *deque, size_t index);
 
@@ -181,8 +243,7 @@ status_t deque_remove(deque_t *deque, size_t index);
  * @param output Where to store the element
  * @return SUCCESS on success, error code on failure
  *
- * @note Time complexity: O(n) in worst case, O(1) at ends
- * @note Supports random access to any element
+ * @note Time complexity: O(1)
  */
 status_t deque_get(deque_t *deque, size_t index, void *output);
 
@@ -193,9 +254,132 @@ status_t deque_get(deque_t *deque, size_t index, void *output);
  * @param element New element value
  * @return SUCCESS on success, error code on failure
  *
- * @note Time complexity: O(n) in worst case, O(1) at ends
- * @note Supports random modification of any element
+ * @note Time complexity: O(1)
  */
 status_t deque_set(deque_t *deque, size_t index, const void *element);
 
+/*
+ * @brief Gets direct pointer to element at index without copying
+ * @param deque Target deque
+ * @param index Index of element
+ * @return Pointer to element, NULL if out of bounds or error
+ *
+ * @note Time complexity: O(1)
+ * @warning Unsafe: returned pointer becomes invalid if deque is modified
+ */
+void *deque_get_ref(const deque_t *deque, size_t index);
+
+/*
+ * @brief Copies a range of elements into a contiguous buffer
+ * @param deque Source deque
+ * @param index Index of the first element to copy
+ * @param count Number of elements to copy
+ * @param output Destination buffer of at least count * element_size bytes
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(count)
+ * @note Performs at most two block copies, however the range wraps
+ */
+status_t deque_copy_to(const deque_t *deque, size_t index, size_t count,
+                       void *output);
+
+/*
+ * @brief Removes all elements from the deque
+ * @param deque Target deque
+ *
+ * @note Time complexity: O(1)
+ * @note Keeps the buffer for reuse
+ */
+void deque_clear(deque_t *deque);
+
+/* ===== WORK-STEALING DEQUE OPERATIONS ===== */
+
+/*
+ * @brief Creates a new work-stealing deque
+ * @param element_size Size of each element in bytes
+ * @param capacity Initial capacity, rounded up to a power of two
+ * @return Pointer to new deque, NULL on failure
+ *
+ * @note The array doubles when the owner pushes into a full deque
+ * @warning Only the creating (owner) thread may push and pop
+ */
+deque_ws_t *deque_ws_create(size_t element_size, size_t capacity);
+
+/*
+ * @brief Creates a new work-stealing deque that allocates through a custom
+ * allocator
+ * @param element_size Size of each element in bytes
+ * @param capacity Initial capacity, rounded up to a power of two
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @return Pointer to new deque, NULL on failure
+ *
+ * @note Growth allocates from the owner thread only
+ */
+deque_ws_t *deque_ws_create_with_allocator(size_t element_size,
+                                           size_t capacity,
+                                           const allocator_t *allocator);
+
+/*
+ * @brief Destroys a work-stealing deque and frees all memory
+ * @param deque Pointer to deque to destroy
+ *
+ * @note Safely handles NULL pointers
+ * @note Also frees every array retired by growth
+ * @warning No thread may be using the deque
+ */
+void deque_ws_destroy(deque_ws_t *deque);
+
+/*
+ * @brief Pushes an element onto the bottom (owner only)
+ * @param deque Target deque
+ * @param element Element to push
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(1) amortized, lock-free
+ */
+status_t deque_ws_push(deque_ws_t *deque, const void *element);
+
+/*
+ * @brief Pops the most recently pushed element (owner only)
+ * @param deque Target deque
+ * @param output Where to store the element (can be NULL if not needed)
+ * @return SUCCESS, or ERROR_EMPTY_CONTAINER if nothing is left
+ *
+ * @note Time complexity: O(1); a CAS is only needed for the last element,
+ * where the owner may race with a thief
+ */
+status_t deque_ws_pop(deque_ws_t *deque, void *output);
+
+/*
+ * @brief Steals the oldest element from the top (any thread)
+ * @param deque Target deque
+ * @param output Where to store the element (can be NULL if not needed)
+ * @return SUCCESS, or ERROR_EMPTY_CONTAINER if nothing is left
+ *
+ * @note Time complexity: O(1) per attempt, lock-free; retries internally
+ * when another thief or the owner wins the race for the same element
+ * @warning output is overwritten even when the call ends up failing
+ */
+status_t deque_ws_steal(deque_ws_t *deque, void *output);
+
+/*
+ * @brief Gets the approximate number of elements
+ * @param deque Target deque
+ * @return Number of elements, 0 if deque is NULL
+ *
+ * @note Time complexity: O(1)
+ * @note Only a snapshot while other threads are running
+ */
+size_t deque_ws_size(const deque_ws_t *deque);
+
+/*
+ * @brief Checks if the deque is empty
+ * @param deque Target deque
+ * @return true if empty, false otherwise
+ *
+ * @note Time complexity: O(1)
+ * @note Only a snapshot while other threads are running
+ */
+bool deque_ws_empty(const deque_ws_t *deque);
+
 #endif /* CSTRUCTS_DEQUE_H */
@@ -0,0 +1,373 @@
+/*
+ * @file pqueue.h
+ * @brief Priority Queue Data Structure (Heap)
+ * @author Rodrigo Martins
+ * @version 0.0
+ * @date 2024
+ *
+ * CStructs+ Library - Priority Queue Module
+ * Provides d-ary heap priority queues stored in vectors
+ */
+
+#ifndef CSTRUCTS_PQUEUE_H
+#define CSTRUCTS_PQUEUE_H
+
+#include "../module 1/core.h"
+#include "../module 2/vector.h"
+#include <stdbool.h>
+
+/* ===== CONSTANTS ===== */
+
+#define PQUEUE_DEFAULT_ARITY 2 // Binary heap
+
+/* ===== PRIORITY QUEUE USING HEAP ===== */
+
+/*
+ * @brief Priority queue implemented as an implicit d-ary heap in a vector
+ *
+ * @note The element that compares lowest under cmp is on top (a min-heap);
+ * pass a reversed comparison for a max-heap
+ * @note Node i has children d*i + 1 .. d*i + d. A 4-ary heap is half as
+ * deep as a binary one and its children share a cache line for small
+ * elements, which pays off on large heaps
+ */
+typedef struct
+{
+        vector_t *vector; // Heap-ordered element storage
+        cmp_fn cmp;       // Ordering; lowest element is on top
+        size_t arity;     // Children per node (d)
+} pqueue_t;
+
+/* ===== PRIORITY QUEUE CREATION AND DESTRUCTION ===== */
+
+/*
+ * @brief Creates a new binary-heap priority queue
+ * @param element_size Size of each element in bytes
+ * @param cmp Ordering function; the lowest element is popped first
+ * @return Pointer to new priority queue, NULL on failure
+ */
+pqueue_t *pqueue_create(size_t element_size, cmp_fn cmp);
+
+/*
+ * @brief Creates a new d-ary heap priority queue
+ * @param element_size Size of each element in bytes
+ * @param cmp Ordering function; the lowest element is popped first
+ * @param arity Children per node (at least 2; 4 suits large heaps)
+ * @return Pointer to new priority queue, NULL on failure
+ */
+pqueue_t *pqueue_create_with_arity(size_t element_size, cmp_fn cmp,
+                                   size_t arity);
+
+/*
+ * @brief Creates a new d-ary heap that allocates through a custom allocator
+ * @param element_size Size of each element in bytes
+ * @param cmp Ordering function; the lowest element is popped first
+ * @param arity Children per node (at least 2)
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @return Pointer to new priority queue, NULL on failure
+ *
+ * @note The allocator is copied; its context must outlive the queue
+ */
+pqueue_t *pqueue_create_with_allocator(size_t element_size, cmp_fn cmp,
+                                       size_t arity,
+                                       const allocator_t *allocator);
+
+/*
+ * @brief Destroys a priority queue and frees all memory
+ * @param pqueue Pointer to priority queue to destroy
+ *
+ * @note Safely handles NULL pointers
+ */
+void pqueue_destroy(pqueue_t *pqueue);
+
+/* ===== PRIORITY QUEUE OPERATIONS ===== */
+
+/*
+ * @brief Adds an element to the priority queue
+ * @param pqueue Target priority queue
+ * @param element Element to push
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(log n) amortized
+ * @note Sifts a hole up and writes the element once, instead of swapping
+ */
+status_t pqueue_push(pqueue_t *pqueue, const void *element);
+
+/*
+ * @brief Adds many elements at once
+ * @param pqueue Target priority queue
+ * @param elements Contiguous array of elements
+ * @param count Number of elements
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(count log n), or O(n + count) when the batch is
+ * at least as large as the heap and a full rebuild is cheaper
+ */
+status_t pqueue_push_bulk(pqueue_t *pqueue, const void *elements,
+                          size_t count);
+
+/*
+ * @brief Removes the top element
+ * @param pqueue Target priority queue
+ * @param output Where to store the element (can be NULL if not needed)
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(d log_d n)
+ */
+status_t pqueue_pop(pqueue_t *pqueue, void *output);
+
+/*
+ * @brief Peeks at the top element without removing it
+ * @param pqueue Target priority queue
+ * @param output Where to store the top element
+ * @return SUCCESS on success, ERROR_EMPTY_CONTAINER if empty, error code on
+ * failure
+ *
+ * @note Time complexity: O(1)
+ */
+status_t pqueue_peek(const pqueue_t *pqueue, void *output);
+
+/*
+ * @brief Gets direct pointer to the top element without copying
+ * @param pqueue Target priority queue
+ * @return Pointer to top element, NULL if empty or error
+ *
+ * @note Time complexity: O(1)
+ * @warning Modifying the element through the pointer can break heap order
+ */
+const void *pqueue_peek_ref(const pqueue_t *pqueue);
+
+/*
+ * @brief Replaces the contents with an array and builds the heap in place
+ * @param pqueue Target priority queue
+ * @param elements Contiguous array of elements (can be NULL when count is 0)
+ * @param count Number of elements
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(n) bottom-up heap construction
+ */
+status_t pqueue_heapify(pqueue_t *pqueue, const void *elements, size_t count);
+
+/*
+ * @brief Removes all elements
+ * @param pqueue Target priority queue
+ *
+ * @note Time complexity: O(1)
+ */
+void pqueue_clear(pqueue_t *pqueue);
+
+/*
+ * @brief Reserves capacity for at least the given number of elements
+ * @param pqueue Target priority queue
+ * @param capacity Number of elements to make room for
+ * @return SUCCESS on success, error code on failure
+ */
+status_t pqueue_reserve(pqueue_t *pqueue, size_t capacity);
+
+/*
+ * @brief Gets current number of elements
+ * @param pqueue Target priority queue
+ * @return Number of elements, 0 if pqueue is NULL
+ *
+ * @note Time complexity: O(1)
+ */
+size_t pqueue_size(const pqueue_t *pqueue);
+
+/*
+ * @brief Checks if the priority queue is empty
+ * @param pqueue Target priority queue
+ * @return true if empty, false otherwise
+ *
+ * @note Time complexity: O(1)
+ */
+bool pqueue_empty(const pqueue_t *pqueue);
+
+/* ===== INDEXED PRIORITY QUEUE ===== */
+
+/*
+ * @brief Handle value that never refers to a live element
+ */
+#define PQUEUE_INVALID_HANDLE ((size_t)-1)
+
+/*
+ * @brief Priority queue whose elements keep a stable handle
+ *
+ * @note Elements never move in memory; the heap orders their handles and
+ * positions maps each handle back to its heap slot, so any element can be
+ * found, re-prioritized or removed in O(log n) without a search
+ * @note Handles of removed elements are reused by later pushes
+ */
+typedef struct
+{
+        vector_t *elements;     // Element storage indexed by handle
+        vector_t *heap;         // Handles (size_t) in heap order
+        vector_t *positions;    // Heap slot of each handle, or invalid
+        vector_t *free_handles; // Released handles awaiting reuse
+        cmp_fn cmp;             // Ordering; lowest element is on top
+        size_t arity;           // Children per node (d)
+} pqueue_indexed_t;
+
+/*
+ * @brief Creates a new binary-heap indexed priority queue
+ * @param element_size Size of each element in bytes
+ * @param cmp Ordering function; the lowest element is popped first
+ * @return Pointer to new priority queue, NULL on failure
+ */
+pqueue_indexed_t *pqueue_indexed_create(size_t element_size, cmp_fn cmp);
+
+/*
+ * @brief Creates a new indexed d-ary heap with a custom allocator
+ * @param element_size Size of each element in bytes
+ * @param cmp Ordering function; the lowest element is popped first
+ * @param arity Children per node (at least 2)
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @return Pointer to new priority queue, NULL on failure
+ *
+ * @note The allocator is copied; its context must outlive the queue
+ */
+pqueue_indexed_t *pqueue_indexed_create_with_allocator(
+    size_t element_size, cmp_fn cmp, size_t arity,
+    const allocator_t *allocator);
+
+/*
+ * @brief Destroys an indexed priority queue and frees all memory
+ * @param pqueue Pointer to priority queue to destroy
+ *
+ * @note Safely handles NULL pointers
+ */
+void pqueue_indexed_destroy(pqueue_indexed_t *pqueue);
+
+/*
+ * @brief Adds an element and returns its handle
+ * @param pqueue Target priority queue
+ * @param element Element to push
+ * @param handle Where to store the new handle (can be NULL)
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(log n) amortized
+ */
+status_t pqueue_indexed_push(pqueue_indexed_t *pqueue, const void *element,
+                             size_t *handle);
+
+/*
+ * @brief Removes the top element
+ * @param pqueue Target priority queue
+ * @param output Where to store the element (can be NULL)
+ * @param handle Where to store the element's handle (can be NULL)
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(d log_d n)
+ * @note The handle is released and may be returned by a later push
+ */
+status_t pqueue_indexed_pop(pqueue_indexed_t *pqueue, void *output,
+                            size_t *handle);
+
+/*
+ * @brief Peeks at the top element without removing it
+ * @param pqueue Target priority queue
+ * @param output Where to store the element (can be NULL)
+ * @param handle Where to store the element's handle (can be NULL)
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(1)
+ */
+status_t pqueue_indexed_peek(const pqueue_indexed_t *pqueue, void *output,
+                             size_t *handle);
+
+/*
+ * @brief Gets the element stored under a handle
+ * @param pqueue Target priority queue
+ * @param handle Handle returned by push
+ * @param output Where to store the element
+ * @return SUCCESS on success, ERROR_NOT_FOUND if the handle is not live
+ *
+ * @note Time complexity: O(1)
+ */
+status_t pqueue_indexed_get(const pqueue_indexed_t *pqueue, size_t handle,
+                            void *output);
+
+/*
+ * @brief Checks if a handle refers to an element in the queue
+ * @param pqueue Target priority queue
+ * @param handle Handle to check
+ * @return true if live, false otherwise
+ *
+ * @note Time complexity: O(1)
+ */
+bool pqueue_indexed_contains(const pqueue_indexed_t *pqueue, size_t handle);
+
+/*
+ * @brief Replaces an element with one that orders no later
+ * @param pqueue Target priority queue
+ * @param handle Handle of the element
+ * @param element New value; must not compare greater than the old one
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(log_d n)
+ */
+status_t pqueue_indexed_decrease_key(pqueue_indexed_t *pqueue, size_t handle,
+                                     const void *element);
+
+/*
+ * @brief Replaces an element with one that orders no earlier
+ * @param pqueue Target priority queue
+ * @param handle Handle of the element
+ * @param element New value; must not compare lower than the old one
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(d log_d n)
+ */
+status_t pqueue_indexed_increase_key(pqueue_indexed_t *pqueue, size_t handle,
+                                     const void *element);
+
+/*
+ * @brief Replaces an element and moves it in either direction
+ * @param pqueue Target priority queue
+ * @param handle Handle of the element
+ * @param element New value
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(d log_d n)
+ */
+status_t pqueue_indexed_update(pqueue_indexed_t *pqueue, size_t handle,
+                               const void *element);
+
+/*
+ * @brief Removes an element by handle
+ * @param pqueue Target priority queue
+ * @param handle Handle of the element
+ * @param output Where to store the element (can be NULL)
+ * @return SUCCESS on success, ERROR_NOT_FOUND if the handle is not live
+ *
+ * @note Time complexity: O(d log_d n)
+ */
+status_t pqueue_indexed_remove(pqueue_indexed_t *pqueue, size_t handle,
+                               void *output);
+
+/*
+ * @brief Removes all elements and releases every handle
+ * @param pqueue Target priority queue
+ *
+ * @note Time complexity: O(1)
+ */
+void pqueue_indexed_clear(pqueue_indexed_t *pqueue);
+
+/*
+ * @brief Gets current number of elements
+ * @param pqueue Target priority queue
+ * @return Number of elements, 0 if pqueue is NULL
+ *
+ * @note Time complexity: O(1)
+ */
+size_t pqueue_indexed_size(const pqueue_indexed_t *pqueue);
+
+/*
+ * @brief Checks if the indexed priority queue is empty
+ * @param pqueue Target priority queue
+ * @return true if empty, false otherwise
+ *
+ * @note Time complexity: O(1)
+ */
+bool pqueue_indexed_empty(const pqueue_indexed_t *pqueue);
+
+#endif /* CSTRUCTS_PQUEUE_H */
@@ -6,7 +6,9 @@
  * @date 2024
  *
  * CStructs+ Library - Queue Module
- * Provides queue implementation using both arrays and linked lists
+ * Provides queue implementation using both arrays and linked lists, plus
+ * lock-free single-producer/single-consumer and multi-producer/multi-consumer
+ * rings
  */
 
 #ifndef CSTRUCTS_QUEUE_H
@@ -15,6 +17,7 @@
 #include "../module 1/core.h"
 #include "../module 2/vector.h"
 #include "../module 3/singly_list.h"
+#include <stdatomic.h>
 #include <stdbool.h>
 
 /* ===== QUEUE USING CIRCULAR ARRAY ===== */
@@ -30,6 +33,7 @@ typedef struct
         size_t size;         // Current number of elements
         size_t capacity;     // Total capacity
         size_t element_size; // Size of each element
+        allocator_t allocator; // Allocator for the queue and its array
 } queue_array_t;
 
 /* ===== QUEUE USING LINKED LIST ===== */
@@ -42,6 +46,61 @@ typedef struct
         singly_list_t *list; // Using singly linked list as underlying storage
 } queue_list_t;
 
+/* ===== SPSC QUEUE USING LOCK-FREE RING ===== */
+
+/*
+ * @brief Bounded single-producer/single-consumer ring buffer
+ *
+ * @note head and tail are free-running counters; slot = counter & mask
+ * @note Each side keeps a cached copy of the other side's counter and only
+ * reloads it when the ring looks full (producer) or empty (consumer)
+ * @note Padding keeps the read-only, producer and consumer fields on
+ * separate cache lines so the two threads never false-share
+ */
+typedef struct
+{
+        void *data;          // Pointer to slot array
+        size_t mask;         // Capacity - 1 (capacity is a power of two)
+        size_t element_size; // Size of each element
+        allocator_t allocator; // Allocator for the queue and its slots
+        char pad_config[CSTRUCTS_CACHE_LINE_SIZE];
+
+        atomic_size_t tail;  // Next slot to write (written by producer)
+        size_t cached_head;  // Producer's last observed head
+        char pad_producer[CSTRUCTS_CACHE_LINE_SIZE];
+
+        atomic_size_t head;  // Next slot to read (written by consumer)
+        size_t cached_tail;  // Consumer's last observed tail
+        char pad_consumer[CSTRUCTS_CACHE_LINE_SIZE];
+} queue_spsc_t;
+
+/* ===== MPMC QUEUE USING SEQUENCE-NUMBER RING ===== */
+
+/*
+ * @brief Bounded multi-producer/multi-consumer ring buffer
+ *
+ * @note Every cell starts with a sequence counter followed by the element.
+ * A cell at position pos is free for the producer when its sequence equals
+ * pos and full for the consumer when it equals pos + 1, so claiming a cell
+ * takes a single CAS on enqueue_pos or dequeue_pos
+ * @note Padding keeps the two position counters on separate cache lines
+ */
+typedef struct
+{
+        unsigned char *cells; // Cell array (sequence + element per cell)
+        size_t mask;          // Capacity - 1 (capacity is a power of two)
+        size_t element_size;  // Size of each element
+        size_t cell_size;     // Stride between cells in bytes
+        allocator_t allocator; // Allocator for the queue and its cells
+        char pad_config[CSTRUCTS_CACHE_LINE_SIZE];
+
+        atomic_size_t enqueue_pos; // Next position producers claim
+        char pad_enqueue[CSTRUCTS_CACHE_LINE_SIZE];
+
+        atomic_size_t dequeue_pos; // Next position consumers claim
+        char pad_dequeue[CSTRUCTS_CACHE_LINE_SIZE];
+} queue_mpmc_t;
+
 /* ===== ARRAY QUEUE OPERATIONS ===== */
 
 /*
@@ -65,6 +124,21 @@ queue_array_t *queue_array_create(size_t element_size);
  */
 queue_array_t *queue_array_create_with_capacity(size_t element_size,
                                                 size_t capacity);
+
+/*
+ * @brief Creates a new array-based queue that allocates through a custom
+ * allocator
+ * @param element_size Size of each element in bytes
+ * @param capacity Initial capacity of the queue
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @return Pointer to new queue, NULL on failure
+ *
+ * @note The allocator is copied; its context must outlive the queue
+ */
+queue_array_t *queue_array_create_with_allocator(size_t element_size,
+                                                 size_t capacity,
+                                                 const allocator_t *allocator);
+
 /*
  * @brief Destroys an array-based queue and frees all memory
  * @param queue Pointer to queue to destroy
@@ -167,6 +241,18 @@ status_t queue_array_reserve(queue_array_t *queue, size_t capacity);
  */
 queue_list_t *queue_list_create(size_t element_size);
 
+/*
+ * @brief Creates a new linked list-based queue that allocates through a
+ * custom allocator
+ * @param element_size Size of each element in bytes
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @return Pointer to new queue, NULL on failure
+ *
+ * @note The queue structure and every node come from the allocator
+ */
+queue_list_t *queue_list_create_with_allocator(size_t element_size,
+                                               const allocator_t *allocator);
+
 /*
  * @brief Destroys a linked list-based queue and frees all memory
  * @param queue Pointer to queue to destroy
@@ -237,6 +323,245 @@ size_t queue_list_size(const queue_list_t *queue);
  */
 bool queue_list_empty(const queue_list_t *queue);
 
+/* ===== SPSC QUEUE OPERATIONS ===== */
+
+/*
+ * @brief Creates a new single-producer/single-consumer queue
+ * @param element_size Size of each element in bytes
+ * @param capacity Maximum number of elements, rounded up to a power of two
+ * @return Pointer to new queue, NULL on failure
+ *
+ * @note The ring never grows; enqueue fails with ERROR_FULL_CONTAINER
+ * @warning Exactly one thread may produce and one thread may consume
+ */
+queue_spsc_t *queue_spsc_create(size_t element_size, size_t capacity);
+
+/*
+ * @brief Creates a new SPSC queue that allocates through a custom allocator
+ * @param element_size Size of each element in bytes
+ * @param capacity Maximum number of elements, rounded up to a power of two
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @return Pointer to new queue, NULL on failure
+ *
+ * @note The allocator is only used by create and destroy
+ */
+queue_spsc_t *queue_spsc_create_with_allocator(size_t element_size,
+                                               size_t capacity,
+                                               const allocator_t *allocator);
+
+/*
+ * @brief Destroys an SPSC queue and frees all memory
+ * @param queue Pointer to queue to destroy
+ *
+ * @note Safely handles NULL pointers
+ * @warning Neither side may be using the queue
+ */
+void queue_spsc_destroy(queue_spsc_t *queue);
+
+/*
+ * @brief Copies an element into the queue (producer only)
+ * @param queue Target queue
+ * @param element Element to enqueue
+ * @return SUCCESS, or ERROR_FULL_CONTAINER if no slot is free
+ *
+ * @note Time complexity: O(1), wait-free
+ */
+status_t queue_spsc_try_enqueue(queue_spsc_t *queue, const void *element);
+
+/*
+ * @brief Copies the oldest element out of the queue (consumer only)
+ * @param queue Target queue
+ * @param output Where to store the element (can be NULL if not needed)
+ * @return SUCCESS, or ERROR_EMPTY_CONTAINER if nothing is queued
+ *
+ * @note Time complexity: O(1), wait-free
+ */
+status_t queue_spsc_try_dequeue(queue_spsc_t *queue, void *output);
+
+/*
+ * @brief Reserves free slots for in-place writing (producer only)
+ * @param queue Target queue
+ * @param max_count Maximum number of slots wanted
+ * @param count Receives the number of contiguous slots reserved
+ * @return Pointer to the first reserved slot, NULL if none are free
+ *
+ * @note Time complexity: O(1)
+ * @note Slots are contiguous, so fewer than max_count may be returned at the
+ * wrap point; call again after committing to get the rest
+ * @warning Slots are invisible to the consumer until queue_spsc_commit
+ */
+void *queue_spsc_reserve(queue_spsc_t *queue, size_t max_count,
+                         size_t *count);
+
+/*
+ * @brief Publishes slots filled after queue_spsc_reserve (producer only)
+ * @param queue Target queue
+ * @param count Number of slots to publish (at most the reserved count)
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(1)
+ */
+status_t queue_spsc_commit(queue_spsc_t *queue, size_t count);
+
+/*
+ * @brief Exposes queued elements for in-place reading (consumer only)
+ * @param queue Target queue
+ * @param max_count Maximum number of elements wanted
+ * @param count Receives the number of contiguous elements exposed
+ * @return Pointer to the oldest element, NULL if the queue is empty
+ *
+ * @note Time complexity: O(1)
+ * @warning Elements stay owned by the queue until queue_spsc_release
+ */
+void *queue_spsc_acquire(queue_spsc_t *queue, size_t max_count,
+                         size_t *count);
+
+/*
+ * @brief Returns slots read after queue_spsc_acquire (consumer only)
+ * @param queue Target queue
+ * @param count Number of elements consumed (at most the acquired count)
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(1)
+ */
+status_t queue_spsc_release(queue_spsc_t *queue, size_t count);
+
+/*
+ * @brief Gets the number of queued elements
+ * @param queue Target queue
+ * @return Number of elements, 0 if queue is NULL
+ *
+ * @note Time complexity: O(1)
+ * @note Only a snapshot while the other side is running
+ */
+size_t queue_spsc_size(const queue_spsc_t *queue);
+
+/*
+ * @brief Checks if queue is empty
+ * @param queue Target queue
+ * @return true if empty, false otherwise
+ *
+ * @note Time complexity: O(1)
+ * @note Only a snapshot while the other side is running
+ */
+bool queue_spsc_empty(const queue_spsc_t *queue);
+
+/*
+ * @brief Gets the fixed capacity of the queue
+ * @param queue Target queue
+ * @return Capacity, 0 if queue is NULL
+ *
+ * @note Time complexity: O(1)
+ */
+size_t queue_spsc_capacity(const queue_spsc_t *queue);
+
+/* ===== MPMC QUEUE OPERATIONS ===== */
+
+/*
+ * @brief Creates a new multi-producer/multi-consumer queue
+ * @param element_size Size of each element in bytes
+ * @param capacity Maximum number of elements, rounded up to a power of two
+ * (at least 2)
+ * @return Pointer to new queue, NULL on failure
+ *
+ * @note The ring never grows; try_enqueue fails with ERROR_FULL_CONTAINER
+ * @note Any number of threads may enqueue and dequeue concurrently
+ */
+queue_mpmc_t *queue_mpmc_create(size_t element_size, size_t capacity);
+
+/*
+ * @brief Creates a new MPMC queue that allocates through a custom allocator
+ * @param element_size Size of each element in bytes
+ * @param capacity Maximum number of elements, rounded up to a power of two
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @return Pointer to new queue, NULL on failure
+ *
+ * @note The allocator is only used by create and destroy
+ */
+queue_mpmc_t *queue_mpmc_create_with_allocator(size_t element_size,
+                                               size_t capacity,
+                                               const allocator_t *allocator);
+
+/*
+ * @brief Destroys an MPMC queue and frees all memory
+ * @param queue Pointer to queue to destroy
+ *
+ * @note Safely handles NULL pointers
+ * @warning No thread may be using the queue
+ */
+void queue_mpmc_destroy(queue_mpmc_t *queue);
+
+/*
+ * @brief Copies an element into the queue if a cell is free
+ * @param queue Target queue
+ * @param element Element to enqueue
+ * @return SUCCESS, or ERROR_FULL_CONTAINER if the queue is full
+ *
+ * @note Time complexity: O(1), lock-free (one CAS when uncontended)
+ */
+status_t queue_mpmc_try_enqueue(queue_mpmc_t *queue, const void *element);
+
+/*
+ * @brief Copies the oldest element out of the queue if there is one
+ * @param queue Target queue
+ * @param output Where to store the element (can be NULL if not needed)
+ * @return SUCCESS, or ERROR_EMPTY_CONTAINER if the queue is empty
+ *
+ * @note Time complexity: O(1), lock-free (one CAS when uncontended)
+ */
+status_t queue_mpmc_try_dequeue(queue_mpmc_t *queue, void *output);
+
+/*
+ * @brief Copies an element into the queue, waiting while it is full
+ * @param queue Target queue
+ * @param element Element to enqueue
+ * @return SUCCESS on success, error code on invalid input
+ *
+ * @note Spins with cpu_relax, then falls back to thread_yield
+ * @warning Never returns if no consumer ever makes room
+ */
+status_t queue_mpmc_enqueue(queue_mpmc_t *queue, const void *element);
+
+/*
+ * @brief Copies the oldest element out of the queue, waiting while empty
+ * @param queue Target queue
+ * @param output Where to store the element (can be NULL if not needed)
+ * @return SUCCESS on success, error code on invalid input
+ *
+ * @note Spins with cpu_relax, then falls back to thread_yield
+ * @warning Never returns if no producer ever enqueues
+ */
+status_t queue_mpmc_dequeue(queue_mpmc_t *queue, void *output);
+
+/*
+ * @brief Gets the approximate number of queued elements
+ * @param queue Target queue
+ * @return Number of elements, 0 if queue is NULL
+ *
+ * @note Time complexity: O(1)
+ * @note Only a snapshot while other threads are running
+ */
+size_t queue_mpmc_size(const queue_mpmc_t *queue);
+
+/*
+ * @brief Checks if queue is empty
+ * @param queue Target queue
+ * @return true if empty, false otherwise
+ *
+ * @note Time complexity: O(1)
+ * @note Only a snapshot while other threads are running
+ */
+bool queue_mpmc_empty(const queue_mpmc_t *queue);
+
+/*
+ * @brief Gets the fixed capacity of the queue
+ * @param queue Target queue
+ * @return Capacity, 0 if queue is NULL
+ *
+ * @note Time complexity: O(1)
+ */
+size_t queue_mpmc_capacity(const queue_mpmc_t *queue);
+
 /* ===== COMMON QUEUE OPERATIONS (MACROS FOR CONVENIENCE) ===== */
 
 /*
@@ -6,7 +6,8 @@
  * @date 2024
  *
  * CStructs+ Library - Stack Module
- * Provides stack implementation using both arrays and linked lists
+ * Provides stack implementation using both arrays and linked lists, plus a
+ * lock-free Treiber stack for sharing between threads
  */
 
 #ifndef CSTRUCTS_STACK_H
@@ -15,7 +16,9 @@
 #include "../module 1/core.h"
 #include "../module 2/vector.h"
 #include "../module 3/singly_list.h"
+#include <stdatomic.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 /* ===== STACK USING ARRAY (VECTOR) ===== */
 
@@ -37,6 +40,49 @@ typedef struct
         singly_list_t *list; // Using singly linked list as underlying storage
 } stack_list_t;
 
+/* ===== LOCK-FREE STACK (TREIBER) ===== */
+
+/*
+ * @brief Nodes in the first storage chunk of a lock-free stack
+ *
+ * @note Chunk k > 0 holds STACK_LOCKFREE_FIRST_CHUNK << (k - 1) nodes, so
+ * storage doubles as the stack grows
+ */
+#define STACK_LOCKFREE_FIRST_CHUNK 64
+
+/*
+ * @brief Number of storage chunks (caps a stack at 2^31 nodes)
+ */
+#define STACK_LOCKFREE_MAX_CHUNKS 26
+
+/*
+ * @brief Lock-free stack safe for any number of pushing and popping threads
+ *
+ * @note Links are 32-bit node indices, not pointers. The head packs the top
+ * index with a 32-bit tag bumped on every update, so a plain 64-bit CAS
+ * detects ABA without double-width CAS support
+ * @note Popped nodes go to a second lock-free stack (the free list) and are
+ * reused by later pushes; node memory is only released by destroy, so a
+ * racing pop never touches freed memory
+ */
+typedef struct
+{
+        _Atomic(unsigned char *) chunks[STACK_LOCKFREE_MAX_CHUNKS]; // Nodes
+        size_t element_size; // Size of each element
+        size_t node_size;    // Stride between nodes in bytes
+        allocator_t allocator; // Allocator for the stack and its chunks
+        char pad_config[CSTRUCTS_CACHE_LINE_SIZE];
+
+        _Atomic(uint64_t) head; // Top index + 1 (0 = empty) | tag << 32
+        char pad_head[CSTRUCTS_CACHE_LINE_SIZE];
+
+        _Atomic(uint64_t) free_list; // Recycled nodes, same encoding
+        char pad_free[CSTRUCTS_CACHE_LINE_SIZE];
+
+        atomic_size_t next_unused; // Next never-used node index
+        char pad_unused[CSTRUCTS_CACHE_LINE_SIZE];
+} stack_lockfree_t;
+
 /* ===== ARRAY STACK OPERATIONS ===== */
 
 /*
@@ -60,6 +106,21 @@ stack_array_t *stack_array_create(size_t element_size);
  */
 stack_array_t *stack_array_create_with_capacity(size_t element_size,
                                                 size_t capacity);
+
+/*
+ * @brief Creates a new array-based stack that allocates through a custom
+ * allocator
+ * @param element_size Size of each element in bytes
+ * @param capacity Initial capacity of the stack
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @return Pointer to new stack, NULL on failure
+ *
+ * @note The stack structure and its vector come from the allocator
+ */
+stack_array_t *stack_array_create_with_allocator(size_t element_size,
+                                                 size_t capacity,
+                                                 const allocator_t *allocator);
+
 /*
  * @brief Destroys an array-based stack and frees all associated memory
  * @param stack Pointer to stack to destroy
@@ -164,6 +225,18 @@ status_t stack_array_reserve(stack_array_t *stack, size_t capacity);
  */
 stack_list_t *stack_list_create(size_t element_size);
 
+/*
+ * @brief Creates a new linked list-based stack that allocates through a
+ * custom allocator
+ * @param element_size Size of each element in bytes
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @return Pointer to new stack, NULL on failure
+ *
+ * @note The stack structure and every node come from the allocator
+ */
+stack_list_t *stack_list_create_with_allocator(size_t element_size,
+                                               const allocator_t *allocator);
+
 /*
  * @brief Destroys a linked list-based stack and frees all memory
  * @param stack Pointer to stack to destroy
@@ -234,6 +307,71 @@ size_t stack_list_size(const stack_list_t *stack);
  */
 bool stack_list_empty(const stack_list_t *stack);
 
+/* ===== LOCK-FREE STACK OPERATIONS ===== */
+
+/*
+ * @brief Creates a new lock-free stack
+ * @param element_size Size of each element in bytes
+ * @return Pointer to new stack, NULL on failure
+ *
+ * @note Node storage is allocated lazily in doubling chunks
+ */
+stack_lockfree_t *stack_lockfree_create(size_t element_size);
+
+/*
+ * @brief Creates a new lock-free stack that allocates through a custom
+ * allocator
+ * @param element_size Size of each element in bytes
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @return Pointer to new stack, NULL on failure
+ *
+ * @warning The allocator is called from whichever thread needs a new chunk,
+ * so it must be thread-safe
+ */
+stack_lockfree_t *stack_lockfree_create_with_allocator(
+    size_t element_size, const allocator_t *allocator);
+
+/*
+ * @brief Destroys a lock-free stack and frees all memory
+ * @param stack Pointer to stack to destroy
+ *
+ * @note Safely handles NULL pointers
+ * @warning No thread may be using the stack
+ */
+void stack_lockfree_destroy(stack_lockfree_t *stack);
+
+/*
+ * @brief Pushes an element onto the stack (any thread)
+ * @param stack Target stack
+ * @param element Element to push
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(1), lock-free
+ * @note Reuses a node from the free list when one is available
+ */
+status_t stack_lockfree_push(stack_lockfree_t *stack, const void *element);
+
+/*
+ * @brief Pops the top element from the stack (any thread)
+ * @param stack Target stack
+ * @param output Where to store the element (can be NULL if not needed)
+ * @return SUCCESS, or ERROR_EMPTY_CONTAINER if the stack is empty
+ *
+ * @note Time complexity: O(1), lock-free
+ * @note The node is recycled through the free list
+ */
+status_t stack_lockfree_pop(stack_lockfree_t *stack, void *output);
+
+/*
+ * @brief Checks if the stack is empty
+ * @param stack Target stack
+ * @return true if empty, false otherwise
+ *
+ * @note Time complexity: O(1)
+ * @note Only a snapshot while other threads are running
+ */
+bool stack_lockfree_empty(const stack_lockfree_t *stack);
+
 /* ===== COMMON STACK OPERATIONS (MACROS FOR CONVENIENCE) ===== */
 
 /*
@@ -0,0 +1,254 @@
+/*
+ * @file hash_map.h
+ * @brief Hash Map Data Structure (Swiss Table)
+ * @author Rodrigo Martins
+ * @version 0.0
+ * @date 2024
+ *
+ * CStructs+ Library - Hash Map Module
+ * Provides an open-addressing hash map with SIMD group probing
+ */
+
+#ifndef CSTRUCTS_HASH_MAP_H
+#define CSTRUCTS_HASH_MAP_H
+
+#include "../module 1/core.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ===== CONSTANTS ===== */
+
+/*
+ * @brief Number of control bytes examined per probe step
+ *
+ * @note Matches one SSE2 register; also the minimum table capacity
+ */
+#define HASH_MAP_GROUP_WIDTH 16
+
+/* ===== HASH MAP STRUCTURE ===== */
+
+/*
+ * @brief Open-addressing hash map in the style of a Swiss table
+ *
+ * @note Every slot has a control byte: empty, deleted (tombstone), or the
+ * low 7 bits of the key's hash. Lookups compare 16 control bytes at once
+ * and only call cmp on slots whose 7-bit tag matches
+ * @note The first HASH_MAP_GROUP_WIDTH control bytes are mirrored after the
+ * last one so a group can be loaded from any slot without wrapping
+ * @note Tables are kept at most 7/8 full, counting tombstones
+ */
+typedef struct
+{
+        int8_t *ctrl;          // Control bytes (capacity + group width)
+        unsigned char *slots;  // Key/value pairs, one per control byte
+        size_t capacity;       // Number of slots (power of two)
+        size_t size;           // Number of stored entries
+        size_t growth_left;    // Inserts into empty slots before rehash
+        size_t key_size;       // Size of each key in bytes
+        size_t value_size;     // Size of each value in bytes
+        size_t value_offset;   // Offset of the value inside a slot
+        size_t slot_size;      // Stride between slots in bytes
+        hash_fn hash;          // Key hash function
+        cmp_fn cmp;            // Key comparison (0 means equal)
+        allocator_t allocator; // Allocator for the map and its table
+} hash_map_t;
+
+/* ===== HASH MAP CREATION AND DESTRUCTION ===== */
+
+/*
+ * @brief Creates a new empty hash map
+ * @param key_size Size of each key in bytes
+ * @param value_size Size of each value in bytes (0 for a set)
+ * @param hash Key hash function
+ * @param cmp Key comparison function; only equality (0) is used
+ * @return Pointer to new map, NULL on failure
+ *
+ * @note Time complexity: O(1)
+ */
+hash_map_t *hash_map_create(size_t key_size, size_t value_size, hash_fn hash,
+                            cmp_fn cmp);
+
+/*
+ * @brief Creates a new hash map that allocates through a custom allocator
+ * @param key_size Size of each key in bytes
+ * @param value_size Size of each value in bytes (0 for a set)
+ * @param hash Key hash function
+ * @param cmp Key comparison function; only equality (0) is used
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @return Pointer to new map, NULL on failure
+ *
+ * @note The allocator is copied; its context must outlive the map
+ */
+hash_map_t *hash_map_create_with_allocator(size_t key_size, size_t value_size,
+                                           hash_fn hash, cmp_fn cmp,
+                                           const allocator_t *allocator);
+
+/*
+ * @brief Destroys a hash map and frees all memory
+ * @param map Pointer to map to destroy
+ *
+ * @note Safely handles NULL pointers
+ */
+void hash_map_destroy(hash_map_t *map);
+
+/* ===== HASH MAP OPERATIONS ===== */
+
+/*
+ * @brief Inserts a key/value pair, replacing the value if the key exists
+ * @param map Target map
+ * @param key Key to insert
+ * @param value Value to store (may be NULL when value_size is 0)
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(1) average, amortized over rehashes
+ * @note Reuses tombstones left by erase before consuming empty slots
+ */
+status_t hash_map_insert(hash_map_t *map, const void *key, const void *value);
+
+/*
+ * @brief Looks up the value stored for a key
+ * @param map Target map
+ * @param key Key to look up
+ * @param value Where to store the value (can be NULL)
+ * @return SUCCESS if found, ERROR_NOT_FOUND otherwise
+ *
+ * @note Time complexity: O(1) average
+ */
+status_t hash_map_get(const hash_map_t *map, const void *key, void *value);
+
+/*
+ * @brief Gets direct pointer to the value stored for a key
+ * @param map Target map
+ * @param key Key to look up
+ * @return Pointer to the value, NULL if not found or error
+ *
+ * @note Time complexity: O(1) average
+ * @warning Unsafe: returned pointer becomes invalid if the map rehashes
+ */
+void *hash_map_get_ref(const hash_map_t *map, const void *key);
+
+/*
+ * @brief Checks if a key is present
+ * @param map Target map
+ * @param key Key to look up
+ * @return true if found, false otherwise
+ *
+ * @note Time complexity: O(1) average
+ */
+bool hash_map_contains(const hash_map_t *map, const void *key);
+
+/*
+ * @brief Removes a key and its value
+ * @param map Target map
+ * @param key Key to remove
+ * @return SUCCESS if removed, ERROR_NOT_FOUND otherwise
+ *
+ * @note Time complexity: O(1) average
+ * @note Leaves a tombstone unless no probe sequence can pass through the
+ * slot, in which case it becomes empty again
+ */
+status_t hash_map_erase(hash_map_t *map, const void *key);
+
+/*
+ * @brief Grows the table so it can hold count entries without rehashing
+ * @param map Target map
+ * @param count Number of entries to make room for
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(n) when the table is rebuilt, O(1) otherwise
+ * @note Rebuilding also discards every tombstone
+ */
+status_t hash_map_reserve(hash_map_t *map, size_t count);
+
+/*
+ * @brief Removes all entries
+ * @param map Target map
+ *
+ * @note Time complexity: O(capacity)
+ * @note Keeps the table for reuse
+ */
+void hash_map_clear(hash_map_t *map);
+
+/* ===== HASH MAP PROPERTIES ===== */
+
+/*
+ * @brief Gets number of entries in map
+ * @param map Target map
+ * @return Number of entries, 0 if map is NULL
+ *
+ * @note Time complexity: O(1)
+ */
+size_t hash_map_size(const hash_map_t *map);
+
+/*
+ * @brief Checks if map is empty
+ * @param map Target map
+ * @return true if empty, false otherwise
+ *
+ * @note Time complexity: O(1)
+ */
+bool hash_map_empty(const hash_map_t *map);
+
+/*
+ * @brief Gets number of slots in the table
+ * @param map Target map
+ * @return Capacity, 0 if map is NULL
+ *
+ * @note Time complexity: O(1)
+ */
+size_t hash_map_capacity(const hash_map_t *map);
+
+/* ===== ITERATION ===== */
+
+/*
+ * @brief Iterator structure for hash map
+ *
+ * @note Visits entries in table order, which is unrelated to insertion order
+ */
+typedef struct
+{
+        hash_map_t *map;
+        size_t index; // Next slot to visit
+        size_t last;  // Slot returned by the previous next (capacity if none)
+} hash_map_iter_t;
+
+/*
+ * @brief Creates an iterator for the map
+ * @param map Target map
+ * @return Iterator structure
+ *
+ * @note Time complexity: O(1) amortized
+ */
+hash_map_iter_t hash_map_iter_create(hash_map_t *map);
+
+/*
+ * @brief Checks if iterator has more entries
+ * @param iter Iterator
+ * @return true if more entries, false otherwise
+ *
+ * @note Time complexity: O(1)
+ */
+bool hash_map_iter_has_next(const hash_map_iter_t *iter);
+
+/*
+ * @brief Advances iterator and gets next entry
+ * @param iter Iterator
+ * @param key Where to store the key (can be NULL)
+ * @param value Where to store the value (can be NULL)
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(1) amortized, O(capacity) for full traversal
+ */
+status_t hash_map_iter_next(hash_map_iter_t *iter, void *key, void *value);
+
+/*
+ * @brief Removes the entry returned by the previous iter_next
+ * @param iter Iterator
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(1)
+ * @note Erasing never moves other entries, so iteration can continue
+ */
+status_t hash_map_iter_remove(hash_map_iter_t *iter);
+
+#endif /* CSTRUCTS_HASH_MAP_H */
@@ -0,0 +1,212 @@
+/*
+ * @file timer_wheel.h
+ * @brief Hierarchical Timing Wheel
+ * @author Rodrigo Martins
+ * @version 0.0
+ * @date 2024
+ *
+ * CStructs+ Library - Timer Module
+ * Provides O(1) timer scheduling and cancellation for large timeout sets
+ */
+
+#ifndef CSTRUCTS_TIMER_WHEEL_H
+#define CSTRUCTS_TIMER_WHEEL_H
+
+#include "../module 1/core.h"
+#include "../module 3/doubly_list.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ===== CONSTANTS ===== */
+
+#define TIMER_WHEEL_SLOT_BITS 6 // log2 of slots per level
+#define TIMER_WHEEL_SLOTS (1u << TIMER_WHEEL_SLOT_BITS) // Slots per level
+#define TIMER_WHEEL_LEVELS 5    // Levels; covers 2^30 ticks exactly
+
+/*
+ * @brief Number of bucket lists: every slot of every level, plus one list
+ * holding the batch that is currently firing
+ */
+#define TIMER_WHEEL_BUCKETS (TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS + 1)
+
+/* ===== TIMER WHEEL STRUCTURE ===== */
+
+/*
+ * @brief Handle to a scheduled timer
+ *
+ * @note A timer is the list node that holds it, so cancelling or
+ * rescheduling needs no search
+ */
+typedef doubly_node_t timer_wheel_timer_t;
+
+/*
+ * @brief Function called for each expired timer
+ * @param timer The expiring timer; may be rescheduled from the callback
+ * @param payload The timer's payload bytes
+ * @param context Pointer passed to timer_wheel_advance
+ */
+typedef void (*timer_wheel_fn)(timer_wheel_timer_t *timer, void *payload,
+                               void *context);
+
+/*
+ * @brief Hierarchical timing wheel (Varghese and Lauck)
+ *
+ * @note Level k has 64 slots of 64^k ticks each. A timer sits at the lowest
+ * level whose span covers its remaining delay, and moves down a level each
+ * time the wheel reaches the start of its slot. Insert, cancel and
+ * reschedule are O(1); each tick is O(1) plus the timers it touches
+ * @note Timers further away than 2^30 ticks park in the top level and are
+ * re-filed each time that slot comes round
+ * @note Every bucket is a doubly_list_t drawing from one shared pool, so a
+ * timer changes bucket by relinking its node, never by copying it
+ */
+typedef struct
+{
+        doubly_list_t *buckets[TIMER_WHEEL_BUCKETS]; // Slot lists + firing
+        pool_t *node_pool;     // Nodes shared by every bucket
+        uint64_t now;          // Last tick processed
+        size_t size;           // Scheduled timers, including firing ones
+        size_t payload_size;   // Size of each timer's payload in bytes
+        allocator_t allocator; // Allocator for the wheel and its pool
+} timer_wheel_t;
+
+/* ===== TIMER WHEEL CREATION AND DESTRUCTION ===== */
+
+/*
+ * @brief Creates a new timing wheel at tick 0
+ * @param payload_size Size of the payload carried by each timer (may be 0)
+ * @return Pointer to new wheel, NULL on failure
+ */
+timer_wheel_t *timer_wheel_create(size_t payload_size);
+
+/*
+ * @brief Creates a new timing wheel that allocates through a custom
+ * allocator
+ * @param payload_size Size of the payload carried by each timer (may be 0)
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @return Pointer to new wheel, NULL on failure
+ *
+ * @note The allocator is copied; its context must outlive the wheel
+ */
+timer_wheel_t *timer_wheel_create_with_allocator(size_t payload_size,
+                                                 const allocator_t *allocator);
+
+/*
+ * @brief Destroys a wheel and every pending timer without firing them
+ * @param wheel Pointer to wheel to destroy
+ *
+ * @note Safely handles NULL pointers
+ */
+void timer_wheel_destroy(timer_wheel_t *wheel);
+
+/* ===== TIMER OPERATIONS ===== */
+
+/*
+ * @brief Schedules a timer
+ * @param wheel Target wheel
+ * @param expires Absolute tick at which to fire; ticks not after the
+ * current one fire on the next tick
+ * @param payload Payload to copy into the timer (may be NULL when
+ * payload_size is 0)
+ * @return Handle of the new timer, NULL on failure
+ *
+ * @note Time complexity: O(1)
+ * @warning The handle is valid until the timer is cancelled or its
+ * callback returns without rescheduling it
+ */
+timer_wheel_timer_t *timer_wheel_add(timer_wheel_t *wheel, uint64_t expires,
+                                     const void *payload);
+
+/*
+ * @brief Cancels a pending timer
+ * @param wheel Target wheel
+ * @param timer Timer to cancel
+ * @param payload Where to store the payload (can be NULL)
+ * @return SUCCESS on success, ERROR_NOT_FOUND if the timer is firing
+ *
+ * @note Time complexity: O(1)
+ * @note Timers later in the batch being fired can still be cancelled from
+ * a callback; the one whose callback is running cannot
+ */
+status_t timer_wheel_cancel(timer_wheel_t *wheel, timer_wheel_timer_t *timer,
+                            void *payload);
+
+/*
+ * @brief Moves a timer to a new expiry tick
+ * @param wheel Target wheel
+ * @param timer Timer to move; may be the one whose callback is running
+ * @param expires New absolute expiry tick
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(1); cheaper than cancel plus add, and the
+ * handle stays the same
+ */
+status_t timer_wheel_reschedule(timer_wheel_t *wheel,
+                                timer_wheel_timer_t *timer, uint64_t expires);
+
+/*
+ * @brief Advances the wheel and fires every timer that comes due
+ * @param wheel Target wheel
+ * @param ticks Number of ticks to advance
+ * @param callback Function called for each expired timer (may be NULL)
+ * @param context Pointer passed through to the callback
+ * @return Number of timers fired
+ *
+ * @note Time complexity: O(ticks + fired + cascaded); an empty wheel jumps
+ * straight to the target tick
+ * @note Each due slot is detached as a batch before any callback runs, so
+ * callbacks may add, cancel and reschedule timers freely
+ */
+size_t timer_wheel_advance(timer_wheel_t *wheel, uint64_t ticks,
+                           timer_wheel_fn callback, void *context);
+
+/* ===== TIMER ACCESS ===== */
+
+/*
+ * @brief Gets direct pointer to a timer's payload
+ * @param timer Target timer
+ * @return Pointer to payload, NULL if timer is NULL
+ *
+ * @note Time complexity: O(1)
+ */
+void *timer_wheel_payload(timer_wheel_timer_t *timer);
+
+/*
+ * @brief Gets the tick at which a timer fires
+ * @param timer Target timer
+ * @return Expiry tick, 0 if timer is NULL
+ *
+ * @note Time complexity: O(1)
+ */
+uint64_t timer_wheel_expires(const timer_wheel_timer_t *timer);
+
+/* ===== TIMER WHEEL PROPERTIES ===== */
+
+/*
+ * @brief Gets the last tick processed
+ * @param wheel Target wheel
+ * @return Current tick, 0 if wheel is NULL
+ *
+ * @note Time complexity: O(1)
+ */
+uint64_t timer_wheel_now(const timer_wheel_t *wheel);
+
+/*
+ * @brief Gets number of scheduled timers
+ * @param wheel Target wheel
+ * @return Number of timers, 0 if wheel is NULL
+ *
+ * @note Time complexity: O(1)
+ */
+size_t timer_wheel_size(const timer_wheel_t *wheel);
+
+/*
+ * @brief Checks if no timers are scheduled
+ * @param wheel Target wheel
+ * @return true if empty, false otherwise
+ *
+ * @note Time complexity: O(1)
+ */
+bool timer_wheel_empty(const timer_wheel_t *wheel);
+
+#endif /* CSTRUCTS_TIMER_WHEEL_H */
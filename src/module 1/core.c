@@ -13,6 +13,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <sched.h>
+#define CSTRUCTS_HAVE_SCHED_YIELD 1
+#else
+#define CSTRUCTS_HAVE_SCHED_YIELD 0
+#endif
+
 /* ===== MEMORY MANAGEMENT IMPLEMENTATION ===== */
 
 void *mem_alloc(size_t size)
@@ -96,228 +103,2306 @@ void mem_free(void **ptr)
     }
 }
 
-/* ===== MEMORY OPERATIONS IMPLEMENTATION ===== */
+/* ===== ALLOCATOR IMPLEMENTATION ===== */
 
-void *mem_copy(void *dest, const void *src, size_t count)
+// Default allocator callbacks forwarding to the mem_* functions
+static void *default_alloc(void *context, size_t size)
 {
-    if (dest == NULL || src == NULL || count == 0)
+    (void)context;
+    return mem_alloc(size);
+}
+
+static void *default_realloc(void *context, void *ptr, size_t old_size,
+                             size_t new_size)
+{
+    (void)context;
+    (void)old_size;
+    return mem_realloc(ptr, new_size);
+}
+
+static void default_free(void *context, void *ptr, size_t size)
+{
+    (void)context;
+    (void)size;
+    mem_free(&ptr);
+}
+
+static const allocator_t default_allocator = {default_alloc, default_realloc,
+                                              default_free, NULL};
+
+const allocator_t *allocator_default(void) { return &default_allocator; }
+
+void *allocator_alloc(const allocator_t *allocator, size_t size)
+{
+    if (allocator == NULL)
     {
-        return dest;
+        allocator = &default_allocator;
     }
 
-    // Use byte-by-byte copy to avoid alignment issues
-    char *dest_bytes = (char *)dest;
-    const char *src_bytes = (const char *)src;
+    return allocator->alloc_fn(allocator->context, size);
+}
 
-    // When the region is small, copy byte-by-byte
-    if (count < 16)
+void *allocator_realloc(const allocator_t *allocator, void *ptr,
+                        size_t old_size, size_t new_size)
+{
+    if (allocator == NULL)
     {
-        for (size_t i = 0; i < count; i++)
-        {
-            dest_bytes[i] = src_bytes[i];
-        }
+        allocator = &default_allocator;
+    }
 
-        return dest;
+    if (ptr == NULL)
+    {
+        return allocator->alloc_fn(allocator->context, new_size);
     }
 
-    // For larger data, try aligning and copying in Word.
-    size_t i = 0;
+    if (allocator->realloc_fn != NULL)
+    {
+        return allocator->realloc_fn(allocator->context, ptr, old_size,
+                                     new_size);
+    }
 
-    // Copies bytes until aligned.
-    while ((i < count) &&
-           ((uintptr_t)(dest_bytes + i) % sizeof(uintptr_t) != 0))
+    // No native realloc: move the data into a fresh block
+    void *new_ptr = allocator->alloc_fn(allocator->context, new_size);
+    if (new_ptr == NULL)
     {
-        dest_bytes[i] = src_bytes[i];
-        i++;
+        return NULL;
     }
 
-    // Copy aligned words.
-    uintptr_t *dest_words = (uintptr_t *)(dest_bytes + i);
-    const uintptr_t *src_words = (const uintptr_t *)(src_bytes + i);
-    size_t word_count = (count - i) / sizeof(uintptr_t);
+    mem_copy(new_ptr, ptr, old_size < new_size ? old_size : new_size);
+    allocator->free_fn(allocator->context, ptr, old_size);
+    return new_ptr;
+}
 
-    for (size_t j = 0; j < word_count; j++)
+void allocator_free(const allocator_t *allocator, void *ptr, size_t size)
+{
+    if (ptr == NULL)
     {
-        dest_words[j] = src_words[j];
+        return;
     }
 
-    i += word_count * sizeof(uintptr_t);
+    if (allocator == NULL)
+    {
+        allocator = &default_allocator;
+    }
 
-    for (; i < count; i++)
+    allocator->free_fn(allocator->context, ptr, size);
+}
+
+bool allocator_equal(const allocator_t *a, const allocator_t *b)
+{
+    if (a == NULL)
     {
-        dest_bytes[i] = src_bytes[i];
+        a = &default_allocator;
+    }
+    if (b == NULL)
+    {
+        b = &default_allocator;
     }
 
-    return dest;
+    return a->alloc_fn == b->alloc_fn && a->realloc_fn == b->realloc_fn &&
+           a->free_fn == b->free_fn && a->context == b->context;
 }
 
-void *mem_set(void *dest, int value, size_t count)
+/* ===== ARENA ALLOCATOR IMPLEMENTATION ===== */
+
+/*
+ * @brief Allocates a chunk and links it after the current one
+ * @param arena Target arena
+ * @param min_capacity Minimum usable bytes the chunk must provide
+ * @return Pointer to new chunk, NULL on allocation failure
+ *
+ * @note Time complexity: O(1)
+ * @note Oversized requests get a chunk of exactly their size so that the
+ * regular chunk size stays small
+ */
+static arena_chunk_t *arena_chunk_create(arena_t *arena, size_t min_capacity)
 {
-    if (dest == NULL || count == 0)
+    size_t capacity =
+        min_capacity > arena->chunk_size ? min_capacity : arena->chunk_size;
+
+    arena_chunk_t *chunk = (arena_chunk_t *)allocator_alloc(
+        &arena->backing, sizeof(arena_chunk_t) + capacity);
+    if (chunk == NULL)
     {
-        return dest;
+        return NULL;
     }
 
-    char *dest_bytes = (char *)dest;
-    for (size_t i = 0; i < count; i++)
+    chunk->capacity = capacity;
+    chunk->used = 0;
+
+    if (arena->current == NULL)
+    {
+        chunk->next = NULL;
+        arena->first = chunk;
+    }
+    else
     {
-        dest_bytes[i] = (char)value;
+        chunk->next = arena->current->next;
+        arena->current->next = chunk;
     }
 
-    return dest;
+    arena->current = chunk;
+    return chunk;
 }
 
-int mem_cmp(const void *ptr1, const void *ptr2, size_t count)
+/*
+ * @brief Tries to bump-allocate from a single chunk
+ * @param chunk Chunk to allocate from
+ * @param size Number of bytes
+ * @param alignment Required alignment, a power of two
+ * @return Pointer to memory, NULL if the chunk has no room
+ *
+ * @note Time complexity: O(1)
+ */
+static void *arena_chunk_bump(arena_chunk_t *chunk, size_t size,
+                              size_t alignment)
 {
-    if (ptr1 == NULL || ptr2 == NULL)
+    uintptr_t base = (uintptr_t)chunk->data;
+    uintptr_t start = (base + chunk->used + alignment - 1) & ~(alignment - 1);
+    size_t offset = (size_t)(start - base);
+
+    if (offset > chunk->capacity || size > chunk->capacity - offset)
     {
-        fprintf(stderr, "ERROR: mem_cmp called with NULL pointer\n");
-        return 0;
+        return NULL;
     }
 
-    if (count == 0)
-        return 0;
+    chunk->used = offset + size;
+    return chunk->data + offset;
+}
 
-    const unsigned char *p1 = (const unsigned char *)ptr1;
-    const unsigned char *p2 = (const unsigned char *)ptr2;
+arena_t *arena_create(size_t chunk_size)
+{
+    return arena_create_with_allocator(chunk_size, NULL);
+}
 
-    for (size_t i = 0; i < count; i++)
+arena_t *arena_create_with_allocator(size_t chunk_size,
+                                     const allocator_t *backing)
+{
+    if (backing == NULL)
     {
-        if (p1[i] != p2[i])
-        {
-            return (int)p1[i] - (int)p2[i];
-        }
+        backing = allocator_default();
     }
 
-    return 0;
+    arena_t *arena = (arena_t *)allocator_alloc(backing, sizeof(arena_t));
+    if (arena == NULL)
+    {
+        return NULL;
+    }
+
+    arena->first = NULL;
+    arena->current = NULL;
+    arena->chunk_size = chunk_size != 0 ? chunk_size : ARENA_DEFAULT_CHUNK_SIZE;
+    arena->backing = *backing;
+
+    return arena;
 }
 
-void *mem_move(void *dest, const void *src, size_t count)
+void arena_destroy(arena_t *arena)
 {
-    if (dest == NULL || src == NULL || count == 0)
+    if (arena == NULL)
     {
-        return dest;
+        return;
     }
 
-    char *dest_bytes = (char *)dest;
-    const char *src_bytes = (const char *)src;
+    // Copy the allocator out: it lives inside the block being freed
+    allocator_t backing = arena->backing;
 
-    // Handle overlapping regions by copying direction
-    if (dest_bytes > src_bytes && dest_bytes < src_bytes + count)
+    arena_chunk_t *chunk = arena->first;
+    while (chunk != NULL)
     {
-        // Overlap: copy from end to beginning
-        for (size_t i = count; i > 0; i--)
-        {
-            dest_bytes[i - 1] = src_bytes[i - 1];
-        }
+        arena_chunk_t *next = chunk->next;
+        allocator_free(&backing, chunk,
+                       sizeof(arena_chunk_t) + chunk->capacity);
+        chunk = next;
     }
-    else
+
+    allocator_free(&backing, arena, sizeof(arena_t));
+}
+
+void *arena_alloc(arena_t *arena, size_t size)
+{
+    return arena_alloc_aligned(arena, size, ARENA_DEFAULT_ALIGNMENT);
+}
+
+void *arena_alloc_aligned(arena_t *arena, size_t size, size_t alignment)
+{
+    if (arena == NULL || size == 0 || alignment == 0 ||
+        (alignment & (alignment - 1)) != 0)
     {
-        // No overlap or dest before src: copy from beginning to end
-        for (size_t i = 0; i < count; i++)
+        fprintf(stderr, "ERROR: Invalid arena allocation request\n");
+        return NULL;
+    }
+
+    if (arena->current != NULL)
+    {
+        void *ptr = arena_chunk_bump(arena->current, size, alignment);
+        if (ptr != NULL)
         {
-            dest_bytes[i] = src_bytes[i];
+            return ptr;
+        }
+
+        // Reuse the next retained chunk if it is large enough
+        arena_chunk_t *next = arena->current->next;
+        if (next != NULL)
+        {
+            next->used = 0;
+            ptr = arena_chunk_bump(next, size, alignment);
+            if (ptr != NULL)
+            {
+                arena->current = next;
+                return ptr;
+            }
         }
     }
 
-    return dest;
-}
+    // Worst case padding needed to align inside a fresh chunk
+    size_t padding = alignment > ARENA_DEFAULT_ALIGNMENT ? alignment - 1 : 0;
+    if (size > SIZE_MAX - padding - sizeof(arena_chunk_t))
+    {
+        fprintf(stderr, "ERROR: Arena allocation size overflow\n");
+        return NULL;
+    }
 
-/* ===== UTILITY FUNCTIONS IMPLEMENTATION ===== */
+    arena_chunk_t *chunk = arena_chunk_create(arena, size + padding);
+    if (chunk == NULL)
+    {
+        return NULL;
+    }
 
-void mem_swap(void *a, void *b, size_t size)
+    return arena_chunk_bump(chunk, size, alignment);
+}
+
+void arena_reset(arena_t *arena)
 {
-    if (a == NULL || b == NULL || size == 0)
+    if (arena == NULL || arena->first == NULL)
     {
         return;
     }
 
-    // Use stack allocation for swapping
-    if (size <= 64)
+    // Later chunks are cleared lazily as allocation advances into them
+    arena->current = arena->first;
+    arena->current->used = 0;
+}
+
+arena_mark_t arena_mark(const arena_t *arena)
+{
+    arena_mark_t mark = {NULL, 0};
+
+    if (arena != NULL && arena->current != NULL)
     {
-        char temp[64];
-        mem_copy(temp, a, size);
-        mem_copy(a, b, size);
-        mem_copy(b, temp, size);
+        mark.chunk = arena->current;
+        mark.used = arena->current->used;
     }
-    // Use heap for swapping
-    else
-    {
-        char *temp = (char *)mem_alloc(size);
-        if (temp == NULL)
-            return;
 
-        // Performs swap with memory copy functions
-        mem_copy(temp, a, size);
-        mem_copy(a, b, size);
-        mem_copy(b, temp, size);
+    return mark;
+}
+
+void arena_rewind(arena_t *arena, arena_mark_t mark)
+{
+    if (arena == NULL)
+    {
+        return;
+    }
 
-        mem_free((void **)&temp);
+    if (mark.chunk == NULL)
+    {
+        arena_reset(arena);
+        return;
     }
+
+    arena->current = mark.chunk;
+    arena->current->used = mark.used;
 }
 
-int cmp_max(int a, int b) { return (a > b) ? a : b; }
+// allocator_t callbacks backed by an arena
+static void *arena_allocator_alloc(void *context, size_t size)
+{
+    return arena_alloc((arena_t *)context, size);
+}
 
-int cmp_min(int a, int b) { return (a < b) ? a : b; }
+static void *arena_allocator_realloc(void *context, void *ptr, size_t old_size,
+                                     size_t new_size)
+{
+    arena_t *arena = (arena_t *)context;
+    arena_chunk_t *chunk = arena->current;
 
-/* ===== COMPARISON FUNCTIONS IMPLEMENTATION ===== */
+    // The most recent allocation can grow or shrink in place
+    if (chunk != NULL &&
+        (unsigned char *)ptr + old_size == chunk->data + chunk->used)
+    {
+        size_t offset = (size_t)((unsigned char *)ptr - chunk->data);
+        if (new_size <= chunk->capacity - offset)
+        {
+            chunk->used = offset + new_size;
+            return ptr;
+        }
+    }
 
-int cmp_fn_int(const void *a, const void *b)
+    void *new_ptr = arena_alloc(arena, new_size);
+    if (new_ptr != NULL)
+    {
+        mem_copy(new_ptr, ptr, old_size < new_size ? old_size : new_size);
+    }
+
+    return new_ptr;
+}
+
+static void arena_allocator_free(void *context, void *ptr, size_t size)
 {
-    const int *int_a = (const int *)a;
-    const int *int_b = (const int *)b;
+    arena_t *arena = (arena_t *)context;
+    arena_chunk_t *chunk = arena->current;
 
-    if (*int_a < *int_b)
-        return -1;
-    if (*int_a > *int_b)
-        return 1;
-    return 0;
+    // Only the most recent allocation can be given back
+    if (chunk != NULL &&
+        (unsigned char *)ptr + size == chunk->data + chunk->used)
+    {
+        chunk->used -= size;
+    }
 }
 
-int cmp_fn_float(const void *a, const void *b)
+allocator_t arena_allocator(arena_t *arena)
 {
-    const float *float_a = (const float *)a;
-    const float *float_b = (const float *)b;
+    allocator_t allocator = {arena_allocator_alloc, arena_allocator_realloc,
+                             arena_allocator_free, arena};
+    return allocator;
+}
 
-    if (*float_a < *float_b)
-        return -1;
-    if (*float_a > *float_b)
-        return 1;
-    return 0;
+/* ===== POOL ALLOCATOR IMPLEMENTATION ===== */
+
+/*
+ * @brief Adds a slab to the pool and makes it the bump region
+ * @param pool Target pool
+ * @return SUCCESS on success, ERROR_MEMORY_ALLOCATION on failure
+ *
+ * @note Time complexity: O(1)
+ */
+static status_t pool_grow(pool_t *pool)
+{
+    size_t bytes = pool->blocks_per_slab * pool->block_size;
+
+    pool_slab_t *slab = (pool_slab_t *)allocator_alloc(
+        &pool->backing, sizeof(pool_slab_t) + bytes);
+    if (slab == NULL)
+    {
+        return ERROR_MEMORY_ALLOCATION;
+    }
+
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+    pool->bump = slab->data;
+    pool->bump_end = slab->data + bytes;
+
+    return SUCCESS;
 }
 
-int cmp_fn_double(const void *a, const void *b)
+pool_t *pool_create(size_t block_size)
 {
-    const double *double_a = (const double *)a;
-    const double *double_b = (const double *)b;
+    return pool_create_with_allocator(block_size, NULL);
+}
 
-    if (*double_a < *double_b)
-        return -1;
-    if (*double_a > *double_b)
-        return 1;
-    return 0;
+pool_t *pool_create_with_allocator(size_t block_size,
+                                   const allocator_t *backing)
+{
+    if (block_size == 0)
+    {
+        fprintf(stderr, "ERROR: Cannot create pool with block size 0\n");
+        return NULL;
+    }
+
+    if (backing == NULL)
+    {
+        backing = allocator_default();
+    }
+
+    pool_t *pool = (pool_t *)allocator_alloc(backing, sizeof(pool_t));
+    if (pool == NULL)
+    {
+        return NULL;
+    }
+
+    // Blocks must hold the free-list link and keep malloc's alignment
+    size_t align = ARENA_DEFAULT_ALIGNMENT;
+    if (block_size < sizeof(void *))
+    {
+        block_size = sizeof(void *);
+    }
+    block_size = (block_size + align - 1) & ~(align - 1);
+
+    size_t blocks = (POOL_SLAB_SIZE - sizeof(pool_slab_t)) / block_size;
+    if (blocks < POOL_MIN_SLAB_BLOCKS)
+    {
+        blocks = POOL_MIN_SLAB_BLOCKS;
+    }
+
+    pool->free_list = NULL;
+    pool->slabs = NULL;
+    pool->bump = NULL;
+    pool->bump_end = NULL;
+    pool->block_size = block_size;
+    pool->blocks_per_slab = blocks;
+    pool->backing = *backing;
+
+    return pool;
 }
 
-int cmp_fn_string(const void *a, const void *b)
+void pool_destroy(pool_t *pool)
 {
-    const char *str_a = *(const char **)a;
-    const char *str_b = *(const char **)b;
+    if (pool == NULL)
+    {
+        return;
+    }
 
-    if (str_a == NULL && str_b == NULL)
-        return 0;
-    if (str_a == NULL)
-        return -1;
-    if (str_b == NULL)
-        return 1;
+    // Copy the allocator out: it lives inside the block being freed
+    allocator_t backing = pool->backing;
+    size_t slab_bytes =
+        sizeof(pool_slab_t) + pool->blocks_per_slab * pool->block_size;
 
-    // Compare strings character by character
-    while (*str_a && *str_b && *str_a == *str_b)
+    pool_slab_t *slab = pool->slabs;
+    while (slab != NULL)
     {
-        str_a++;
-        str_b++;
+        pool_slab_t *next = slab->next;
+        allocator_free(&backing, slab, slab_bytes);
+        slab = next;
     }
 
-    return (*str_a > *str_b) - (*str_a < *str_b);
+    allocator_free(&backing, pool, sizeof(pool_t));
+}
+
+void *pool_alloc(pool_t *pool)
+{
+    if (pool == NULL)
+    {
+        return NULL;
+    }
+
+    // Recycle released blocks first
+    if (pool->free_list != NULL)
+    {
+        void *block = pool->free_list;
+        pool->free_list = *(void **)block;
+        return block;
+    }
+
+    if (pool->bump == pool->bump_end && pool_grow(pool) != SUCCESS)
+    {
+        return NULL;
+    }
+
+    void *block = pool->bump;
+    pool->bump += pool->block_size;
+    return block;
+}
+
+void pool_free(pool_t *pool, void *block)
+{
+    if (pool == NULL || block == NULL)
+    {
+        return;
+    }
+
+    *(void **)block = pool->free_list;
+    pool->free_list = block;
+}
+
+// allocator_t callbacks backed by a pool
+static void *pool_allocator_alloc(void *context, size_t size)
+{
+    pool_t *pool = (pool_t *)context;
+
+    if (size > pool->block_size)
+    {
+        fprintf(stderr, "ERROR: Pool block of %zu bytes cannot hold %zu\n",
+                pool->block_size, size);
+        return NULL;
+    }
+
+    return pool_alloc(pool);
+}
+
+static void *pool_allocator_realloc(void *context, void *ptr, size_t old_size,
+                                    size_t new_size)
+{
+    pool_t *pool = (pool_t *)context;
+    (void)old_size;
+
+    return new_size <= pool->block_size ? ptr
+                                        : pool_allocator_alloc(pool, new_size);
+}
+
+static void pool_allocator_free(void *context, void *ptr, size_t size)
+{
+    (void)size;
+    pool_free((pool_t *)context, ptr);
+}
+
+allocator_t pool_allocator(pool_t *pool)
+{
+    allocator_t allocator = {pool_allocator_alloc, pool_allocator_realloc,
+                             pool_allocator_free, pool};
+    return allocator;
+}
+
+/* ===== CONSTANTS ===== */
+
+#define MEM_SWAP_CHUNK 256 // Stack buffer used by mem_swap for large elements
+
+#if defined(__GNUC__)
+// Unaligned scalar accesses used by the small-size paths
+typedef uint16_t __attribute__((may_alias, aligned(1))) mem_u16_t;
+typedef uint32_t __attribute__((may_alias, aligned(1))) mem_u32_t;
+typedef uint64_t __attribute__((may_alias, aligned(1))) mem_u64_t;
+#endif
+
+/* ===== SCALAR MEMORY KERNELS ===== */
+
+/*
+ * @brief Portable forward copy using word-sized transfers
+ * @param dest Destination memory address
+ * @param src Source memory address
+ * @param count Number of bytes to copy
+ *
+ * @note Time complexity: O(n) where n is count
+ * @note Also safe for overlapping regions when dest is before src
+ */
+static void mem_copy_scalar(void *dest, const void *src, size_t count)
+{
+    char *dest_bytes = (char *)dest;
+    const char *src_bytes = (const char *)src;
+
+    // When the region is small, copy byte-by-byte
+    if (count < 16)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            dest_bytes[i] = src_bytes[i];
+        }
+
+        return;
+    }
+
+    // For larger data, try aligning and copying in Word.
+    size_t i = 0;
+
+    // Copies bytes until aligned.
+    while ((i < count) &&
+           ((uintptr_t)(dest_bytes + i) % sizeof(uintptr_t) != 0))
+    {
+        dest_bytes[i] = src_bytes[i];
+        i++;
+    }
+
+    // Copy aligned words.
+    uintptr_t *dest_words = (uintptr_t *)(dest_bytes + i);
+    const uintptr_t *src_words = (const uintptr_t *)(src_bytes + i);
+    size_t word_count = (count - i) / sizeof(uintptr_t);
+
+    for (size_t j = 0; j < word_count; j++)
+    {
+        dest_words[j] = src_words[j];
+    }
+
+    i += word_count * sizeof(uintptr_t);
+
+    for (; i < count; i++)
+    {
+        dest_bytes[i] = src_bytes[i];
+    }
+}
+
+/*
+ * @brief Portable copy that handles overlapping regions
+ * @param dest Destination memory address
+ * @param src Source memory address
+ * @param count Number of bytes to copy
+ *
+ * @note Time complexity: O(n) where n is count
+ * @note Copies backwards word-by-word when dest overlaps the end of src
+ */
+static void mem_move_scalar(void *dest, const void *src, size_t count)
+{
+    char *dest_bytes = (char *)dest;
+    const char *src_bytes = (const char *)src;
+
+    // Forward copy is safe unless dest starts inside the source region
+    if ((uintptr_t)dest_bytes - (uintptr_t)src_bytes >= count)
+    {
+        mem_copy_scalar(dest, src, count);
+        return;
+    }
+
+    // Overlap: copy from end to beginning, aligning the destination end
+    size_t i = count;
+    while (i > 0 && (uintptr_t)(dest_bytes + i) % sizeof(uintptr_t) != 0)
+    {
+        i--;
+        dest_bytes[i] = src_bytes[i];
+    }
+
+    while (i >= sizeof(uintptr_t))
+    {
+        i -= sizeof(uintptr_t);
+        *(uintptr_t *)(dest_bytes + i) = *(const uintptr_t *)(src_bytes + i);
+    }
+
+    while (i > 0)
+    {
+        i--;
+        dest_bytes[i] = src_bytes[i];
+    }
+}
+
+/*
+ * @brief Portable fill using word-sized stores
+ * @param dest Destination memory address
+ * @param value Byte value to store
+ * @param count Number of bytes to set
+ *
+ * @note Time complexity: O(n) where n is count
+ */
+static void mem_set_scalar(void *dest, int value, size_t count)
+{
+    unsigned char *dest_bytes = (unsigned char *)dest;
+    unsigned char byte = (unsigned char)value;
+    size_t i = 0;
+
+    // Set bytes until aligned
+    while (i < count && (uintptr_t)(dest_bytes + i) % sizeof(uintptr_t) != 0)
+    {
+        dest_bytes[i++] = byte;
+    }
+
+    // Broadcast the byte into every lane of a word
+    uintptr_t word = ((uintptr_t)-1 / 0xFF) * byte;
+    for (; i + sizeof(uintptr_t) <= count; i += sizeof(uintptr_t))
+    {
+        *(uintptr_t *)(dest_bytes + i) = word;
+    }
+
+    for (; i < count; i++)
+    {
+        dest_bytes[i] = byte;
+    }
+}
+
+/*
+ * @brief Portable byte-by-byte comparison
+ * @param ptr1 First memory region
+ * @param ptr2 Second memory region
+ * @param count Number of bytes to compare
+ * @return Difference of the first mismatching bytes, 0 if equal
+ *
+ * @note Time complexity: O(n) where n is count
+ */
+static int mem_cmp_scalar(const void *ptr1, const void *ptr2, size_t count)
+{
+    const unsigned char *p1 = (const unsigned char *)ptr1;
+    const unsigned char *p2 = (const unsigned char *)ptr2;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (p1[i] != p2[i])
+        {
+            return (int)p1[i] - (int)p2[i];
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * @brief Portable equality check with early exit
+ * @param ptr1 First memory region
+ * @param ptr2 Second memory region
+ * @param count Number of bytes to compare
+ * @return true if both regions hold the same bytes
+ *
+ * @note Time complexity: O(n) where n is count
+ */
+static bool mem_eq_scalar(const void *ptr1, const void *ptr2, size_t count)
+{
+    const unsigned char *p1 = (const unsigned char *)ptr1;
+    const unsigned char *p2 = (const unsigned char *)ptr2;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (p1[i] != p2[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* ===== SIMD MEMORY KERNELS (x86) ===== */
+
+#if CSTRUCTS_HAVE_X86_SIMD
+
+#include <immintrin.h>
+
+/*
+ * @brief Copies up to 16 bytes with overlapping head/tail accesses
+ * @param dest Destination memory address
+ * @param src Source memory address
+ * @param count Number of bytes to copy (at most 16)
+ *
+ * @note Time complexity: O(1)
+ * @note All loads happen before any store, so overlapping regions are safe
+ */
+static inline void mem_move_small(unsigned char *dest,
+                                  const unsigned char *src, size_t count)
+{
+    if (count >= 8)
+    {
+        uint64_t head = *(const mem_u64_t *)src;
+        uint64_t tail = *(const mem_u64_t *)(src + count - 8);
+        *(mem_u64_t *)dest = head;
+        *(mem_u64_t *)(dest + count - 8) = tail;
+    }
+    else if (count >= 4)
+    {
+        uint32_t head = *(const mem_u32_t *)src;
+        uint32_t tail = *(const mem_u32_t *)(src + count - 4);
+        *(mem_u32_t *)dest = head;
+        *(mem_u32_t *)(dest + count - 4) = tail;
+    }
+    else if (count >= 2)
+    {
+        uint16_t head = *(const mem_u16_t *)src;
+        uint16_t tail = *(const mem_u16_t *)(src + count - 2);
+        *(mem_u16_t *)dest = head;
+        *(mem_u16_t *)(dest + count - 2) = tail;
+    }
+    else if (count == 1)
+    {
+        *dest = *src;
+    }
+}
+
+/*
+ * @brief Returns true when [dest, dest+count) and [src, src+count) are disjoint
+ */
+static inline bool mem_disjoint(const void *dest, const void *src,
+                                size_t count)
+{
+    return (uintptr_t)dest + count <= (uintptr_t)src ||
+           (uintptr_t)src + count <= (uintptr_t)dest;
+}
+
+/*
+ * @brief SSE2 copy kernel (16-byte vectors), overlap-safe
+ * @param dest Destination memory address
+ * @param src Source memory address
+ * @param count Number of bytes to copy
+ *
+ * @note Time complexity: O(n) where n is count
+ * @note First and last vectors are loaded up front and stored last, so the
+ * main loop can use aligned stores regardless of overlap direction
+ */
+__attribute__((target("sse2"))) static void
+mem_move_sse2(void *dest, const void *src, size_t count)
+{
+    unsigned char *d = (unsigned char *)dest;
+    const unsigned char *s = (const unsigned char *)src;
+
+    if (count <= 16)
+    {
+        mem_move_small(d, s, count);
+        return;
+    }
+
+    __m128i head = _mm_loadu_si128((const __m128i *)s);
+    __m128i tail = _mm_loadu_si128((const __m128i *)(s + count - 16));
+
+    if (count <= 32)
+    {
+        _mm_storeu_si128((__m128i *)d, head);
+        _mm_storeu_si128((__m128i *)(d + count - 16), tail);
+        return;
+    }
+
+    if ((uintptr_t)d - (uintptr_t)s >= count)
+    {
+        // Forward: align the destination, tail vector covers the remainder
+        size_t skip = 16 - ((uintptr_t)d & 15);
+        unsigned char *dp = d + skip;
+        const unsigned char *sp = s + skip;
+        size_t n = count - skip;
+
+        if (count >= MEM_NONTEMPORAL_THRESHOLD && mem_disjoint(d, s, count))
+        {
+            for (; n > 64; n -= 64, dp += 64, sp += 64)
+            {
+                __m128i v0 = _mm_loadu_si128((const __m128i *)sp);
+                __m128i v1 = _mm_loadu_si128((const __m128i *)(sp + 16));
+                __m128i v2 = _mm_loadu_si128((const __m128i *)(sp + 32));
+                __m128i v3 = _mm_loadu_si128((const __m128i *)(sp + 48));
+                _mm_stream_si128((__m128i *)dp, v0);
+                _mm_stream_si128((__m128i *)(dp + 16), v1);
+                _mm_stream_si128((__m128i *)(dp + 32), v2);
+                _mm_stream_si128((__m128i *)(dp + 48), v3);
+            }
+            _mm_sfence();
+        }
+
+        for (; n > 64; n -= 64, dp += 64, sp += 64)
+        {
+            __m128i v0 = _mm_loadu_si128((const __m128i *)sp);
+            __m128i v1 = _mm_loadu_si128((const __m128i *)(sp + 16));
+            __m128i v2 = _mm_loadu_si128((const __m128i *)(sp + 32));
+            __m128i v3 = _mm_loadu_si128((const __m128i *)(sp + 48));
+            _mm_store_si128((__m128i *)dp, v0);
+            _mm_store_si128((__m128i *)(dp + 16), v1);
+            _mm_store_si128((__m128i *)(dp + 32), v2);
+            _mm_store_si128((__m128i *)(dp + 48), v3);
+        }
+        for (; n > 16; n -= 16, dp += 16, sp += 16)
+        {
+            _mm_store_si128((__m128i *)dp,
+                            _mm_loadu_si128((const __m128i *)sp));
+        }
+    }
+    else
+    {
+        // Backward: align the destination end, head vector covers the rest
+        size_t skip = (uintptr_t)(d + count) & 15;
+        unsigned char *dp = d + count - skip;
+        const unsigned char *sp = s + count - skip;
+        size_t n = count - skip;
+
+        for (; n > 64; n -= 64)
+        {
+            dp -= 64;
+            sp -= 64;
+            __m128i v3 = _mm_loadu_si128((const __m128i *)(sp + 48));
+            __m128i v2 = _mm_loadu_si128((const __m128i *)(sp + 32));
+            __m128i v1 = _mm_loadu_si128((const __m128i *)(sp + 16));
+            __m128i v0 = _mm_loadu_si128((const __m128i *)sp);
+            _mm_store_si128((__m128i *)(dp + 48), v3);
+            _mm_store_si128((__m128i *)(dp + 32), v2);
+            _mm_store_si128((__m128i *)(dp + 16), v1);
+            _mm_store_si128((__m128i *)dp, v0);
+        }
+        for (; n > 16; n -= 16)
+        {
+            dp -= 16;
+            sp -= 16;
+            _mm_store_si128((__m128i *)dp,
+                            _mm_loadu_si128((const __m128i *)sp));
+        }
+    }
+
+    _mm_storeu_si128((__m128i *)(d + count - 16), tail);
+    _mm_storeu_si128((__m128i *)d, head);
+}
+
+/*
+ * @brief AVX2 copy kernel (32-byte vectors), overlap-safe
+ * @param dest Destination memory address
+ * @param src Source memory address
+ * @param count Number of bytes to copy
+ *
+ * @note Time complexity: O(n) where n is count
+ * @note Same head/tail scheme as mem_move_sse2
+ */
+__attribute__((target("avx2"))) static void
+mem_move_avx2(void *dest, const void *src, size_t count)
+{
+    unsigned char *d = (unsigned char *)dest;
+    const unsigned char *s = (const unsigned char *)src;
+
+    if (count <= 16)
+    {
+        mem_move_small(d, s, count);
+        return;
+    }
+
+    if (count <= 32)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i *)s);
+        __m128i b = _mm_loadu_si128((const __m128i *)(s + count - 16));
+        _mm_storeu_si128((__m128i *)d, a);
+        _mm_storeu_si128((__m128i *)(d + count - 16), b);
+        return;
+    }
+
+    __m256i head = _mm256_loadu_si256((const __m256i *)s);
+    __m256i tail = _mm256_loadu_si256((const __m256i *)(s + count - 32));
+
+    if (count <= 64)
+    {
+        _mm256_storeu_si256((__m256i *)d, head);
+        _mm256_storeu_si256((__m256i *)(d + count - 32), tail);
+        return;
+    }
+
+    if ((uintptr_t)d - (uintptr_t)s >= count)
+    {
+        size_t skip = 32 - ((uintptr_t)d & 31);
+        unsigned char *dp = d + skip;
+        const unsigned char *sp = s + skip;
+        size_t n = count - skip;
+
+        if (count >= MEM_NONTEMPORAL_THRESHOLD && mem_disjoint(d, s, count))
+        {
+            for (; n > 128; n -= 128, dp += 128, sp += 128)
+            {
+                __m256i v0 = _mm256_loadu_si256((const __m256i *)sp);
+                __m256i v1 = _mm256_loadu_si256((const __m256i *)(sp + 32));
+                __m256i v2 = _mm256_loadu_si256((const __m256i *)(sp + 64));
+                __m256i v3 = _mm256_loadu_si256((const __m256i *)(sp + 96));
+                _mm256_stream_si256((__m256i *)dp, v0);
+                _mm256_stream_si256((__m256i *)(dp + 32), v1);
+                _mm256_stream_si256((__m256i *)(dp + 64), v2);
+                _mm256_stream_si256((__m256i *)(dp + 96), v3);
+            }
+            _mm_sfence();
+        }
+
+        for (; n > 128; n -= 128, dp += 128, sp += 128)
+        {
+            __m256i v0 = _mm256_loadu_si256((const __m256i *)sp);
+            __m256i v1 = _mm256_loadu_si256((const __m256i *)(sp + 32));
+            __m256i v2 = _mm256_loadu_si256((const __m256i *)(sp + 64));
+            __m256i v3 = _mm256_loadu_si256((const __m256i *)(sp + 96));
+            _mm256_store_si256((__m256i *)dp, v0);
+            _mm256_store_si256((__m256i *)(dp + 32), v1);
+            _mm256_store_si256((__m256i *)(dp + 64), v2);
+            _mm256_store_si256((__m256i *)(dp + 96), v3);
+        }
+        for (; n > 32; n -= 32, dp += 32, sp += 32)
+        {
+            _mm256_store_si256((__m256i *)dp,
+                               _mm256_loadu_si256((const __m256i *)sp));
+        }
+    }
+    else
+    {
+        size_t skip = (uintptr_t)(d + count) & 31;
+        unsigned char *dp = d + count - skip;
+        const unsigned char *sp = s + count - skip;
+        size_t n = count - skip;
+
+        for (; n > 128; n -= 128)
+        {
+            dp -= 128;
+            sp -= 128;
+            __m256i v3 = _mm256_loadu_si256((const __m256i *)(sp + 96));
+            __m256i v2 = _mm256_loadu_si256((const __m256i *)(sp + 64));
+            __m256i v1 = _mm256_loadu_si256((const __m256i *)(sp + 32));
+            __m256i v0 = _mm256_loadu_si256((const __m256i *)sp);
+            _mm256_store_si256((__m256i *)(dp + 96), v3);
+            _mm256_store_si256((__m256i *)(dp + 64), v2);
+            _mm256_store_si256((__m256i *)(dp + 32), v1);
+            _mm256_store_si256((__m256i *)dp, v0);
+        }
+        for (; n > 32; n -= 32)
+        {
+            dp -= 32;
+            sp -= 32;
+            _mm256_store_si256((__m256i *)dp,
+                               _mm256_loadu_si256((const __m256i *)sp));
+        }
+    }
+
+    _mm256_storeu_si256((__m256i *)(d + count - 32), tail);
+    _mm256_storeu_si256((__m256i *)d, head);
+}
+
+/*
+ * @brief AVX-512 copy kernel (64-byte vectors), overlap-safe
+ * @param dest Destination memory address
+ * @param src Source memory address
+ * @param count Number of bytes to copy
+ *
+ * @note Time complexity: O(n) where n is count
+ * @note Smaller copies fall through to 16/32-byte head/tail pairs
+ */
+__attribute__((target("avx512f"))) static void
+mem_move_avx512(void *dest, const void *src, size_t count)
+{
+    unsigned char *d = (unsigned char *)dest;
+    const unsigned char *s = (const unsigned char *)src;
+
+    if (count <= 16)
+    {
+        mem_move_small(d, s, count);
+        return;
+    }
+
+    if (count <= 32)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i *)s);
+        __m128i b = _mm_loadu_si128((const __m128i *)(s + count - 16));
+        _mm_storeu_si128((__m128i *)d, a);
+        _mm_storeu_si128((__m128i *)(d + count - 16), b);
+        return;
+    }
+
+    if (count <= 64)
+    {
+        __m256i a = _mm256_loadu_si256((const __m256i *)s);
+        __m256i b = _mm256_loadu_si256((const __m256i *)(s + count - 32));
+        _mm256_storeu_si256((__m256i *)d, a);
+        _mm256_storeu_si256((__m256i *)(d + count - 32), b);
+        return;
+    }
+
+    __m512i head = _mm512_loadu_si512((const void *)s);
+    __m512i tail = _mm512_loadu_si512((const void *)(s + count - 64));
+
+    if (count <= 128)
+    {
+        _mm512_storeu_si512((void *)d, head);
+        _mm512_storeu_si512((void *)(d + count - 64), tail);
+        return;
+    }
+
+    if ((uintptr_t)d - (uintptr_t)s >= count)
+    {
+        size_t skip = 64 - ((uintptr_t)d & 63);
+        unsigned char *dp = d + skip;
+        const unsigned char *sp = s + skip;
+        size_t n = count - skip;
+
+        if (count >= MEM_NONTEMPORAL_THRESHOLD && mem_disjoint(d, s, count))
+        {
+            for (; n > 256; n -= 256, dp += 256, sp += 256)
+            {
+                __m512i v0 = _mm512_loadu_si512((const void *)sp);
+                __m512i v1 = _mm512_loadu_si512((const void *)(sp + 64));
+                __m512i v2 = _mm512_loadu_si512((const void *)(sp + 128));
+                __m512i v3 = _mm512_loadu_si512((const void *)(sp + 192));
+                _mm512_stream_si512((void *)dp, v0);
+                _mm512_stream_si512((void *)(dp + 64), v1);
+                _mm512_stream_si512((void *)(dp + 128), v2);
+                _mm512_stream_si512((void *)(dp + 192), v3);
+            }
+            _mm_sfence();
+        }
+
+        for (; n > 256; n -= 256, dp += 256, sp += 256)
+        {
+            __m512i v0 = _mm512_loadu_si512((const void *)sp);
+            __m512i v1 = _mm512_loadu_si512((const void *)(sp + 64));
+            __m512i v2 = _mm512_loadu_si512((const void *)(sp + 128));
+            __m512i v3 = _mm512_loadu_si512((const void *)(sp + 192));
+            _mm512_store_si512((void *)dp, v0);
+            _mm512_store_si512((void *)(dp + 64), v1);
+            _mm512_store_si512((void *)(dp + 128), v2);
+            _mm512_store_si512((void *)(dp + 192), v3);
+        }
+        for (; n > 64; n -= 64, dp += 64, sp += 64)
+        {
+            _mm512_store_si512((void *)dp,
+                               _mm512_loadu_si512((const void *)sp));
+        }
+    }
+    else
+    {
+        size_t skip = (uintptr_t)(d + count) & 63;
+        unsigned char *dp = d + count - skip;
+        const unsigned char *sp = s + count - skip;
+        size_t n = count - skip;
+
+        for (; n > 256; n -= 256)
+        {
+            dp -= 256;
+            sp -= 256;
+            __m512i v3 = _mm512_loadu_si512((const void *)(sp + 192));
+            __m512i v2 = _mm512_loadu_si512((const void *)(sp + 128));
+            __m512i v1 = _mm512_loadu_si512((const void *)(sp + 64));
+            __m512i v0 = _mm512_loadu_si512((const void *)sp);
+            _mm512_store_si512((void *)(dp + 192), v3);
+            _mm512_store_si512((void *)(dp + 128), v2);
+            _mm512_store_si512((void *)(dp + 64), v1);
+            _mm512_store_si512((void *)dp, v0);
+        }
+        for (; n > 64; n -= 64)
+        {
+            dp -= 64;
+            sp -= 64;
+            _mm512_store_si512((void *)dp,
+                               _mm512_loadu_si512((const void *)sp));
+        }
+    }
+
+    _mm512_storeu_si512((void *)(d + count - 64), tail);
+    _mm512_storeu_si512((void *)d, head);
+}
+
+/*
+ * @brief Fills up to 16 bytes with overlapping head/tail stores
+ * @param dest Destination memory address
+ * @param byte Byte value to store
+ * @param count Number of bytes to set (at most 16)
+ *
+ * @note Time complexity: O(1)
+ */
+static inline void mem_set_small(unsigned char *dest, unsigned char byte,
+                                 size_t count)
+{
+    uint64_t word = 0x0101010101010101ULL * byte;
+
+    if (count >= 8)
+    {
+        *(mem_u64_t *)dest = word;
+        *(mem_u64_t *)(dest + count - 8) = word;
+    }
+    else if (count >= 4)
+    {
+        *(mem_u32_t *)dest = (uint32_t)word;
+        *(mem_u32_t *)(dest + count - 4) = (uint32_t)word;
+    }
+    else if (count >= 2)
+    {
+        *(mem_u16_t *)dest = (uint16_t)word;
+        *(mem_u16_t *)(dest + count - 2) = (uint16_t)word;
+    }
+    else if (count == 1)
+    {
+        *dest = byte;
+    }
+}
+
+/*
+ * @brief SSE2 fill kernel (16-byte broadcast)
+ * @param dest Destination memory address
+ * @param value Byte value to store
+ * @param count Number of bytes to set
+ *
+ * @note Time complexity: O(n) where n is count
+ * @note Unaligned head/tail stores bracket an aligned main loop
+ */
+__attribute__((target("sse2"))) static void
+mem_set_sse2(void *dest, int value, size_t count)
+{
+    unsigned char *d = (unsigned char *)dest;
+
+    if (count <= 16)
+    {
+        mem_set_small(d, (unsigned char)value, count);
+        return;
+    }
+
+    __m128i v = _mm_set1_epi8((char)value);
+    _mm_storeu_si128((__m128i *)d, v);
+    _mm_storeu_si128((__m128i *)(d + count - 16), v);
+
+    unsigned char *dp = (unsigned char *)(((uintptr_t)d + 16) & ~(uintptr_t)15);
+    unsigned char *end = d + count - 16;
+
+    if (count >= MEM_NONTEMPORAL_THRESHOLD)
+    {
+        for (; dp + 48 < end; dp += 64)
+        {
+            _mm_stream_si128((__m128i *)dp, v);
+            _mm_stream_si128((__m128i *)(dp + 16), v);
+            _mm_stream_si128((__m128i *)(dp + 32), v);
+            _mm_stream_si128((__m128i *)(dp + 48), v);
+        }
+        _mm_sfence();
+    }
+
+    for (; dp + 48 < end; dp += 64)
+    {
+        _mm_store_si128((__m128i *)dp, v);
+        _mm_store_si128((__m128i *)(dp + 16), v);
+        _mm_store_si128((__m128i *)(dp + 32), v);
+        _mm_store_si128((__m128i *)(dp + 48), v);
+    }
+    for (; dp < end; dp += 16)
+    {
+        _mm_store_si128((__m128i *)dp, v);
+    }
+}
+
+/*
+ * @brief AVX2 fill kernel (32-byte broadcast)
+ * @param dest Destination memory address
+ * @param value Byte value to store
+ * @param count Number of bytes to set
+ *
+ * @note Time complexity: O(n) where n is count
+ */
+__attribute__((target("avx2"))) static void
+mem_set_avx2(void *dest, int value, size_t count)
+{
+    unsigned char *d = (unsigned char *)dest;
+
+    if (count <= 32)
+    {
+        mem_set_sse2(dest, value, count);
+        return;
+    }
+
+    __m256i v = _mm256_set1_epi8((char)value);
+    _mm256_storeu_si256((__m256i *)d, v);
+    _mm256_storeu_si256((__m256i *)(d + count - 32), v);
+
+    unsigned char *dp = (unsigned char *)(((uintptr_t)d + 32) & ~(uintptr_t)31);
+    unsigned char *end = d + count - 32;
+
+    if (count >= MEM_NONTEMPORAL_THRESHOLD)
+    {
+        for (; dp + 96 < end; dp += 128)
+        {
+            _mm256_stream_si256((__m256i *)dp, v);
+            _mm256_stream_si256((__m256i *)(dp + 32), v);
+            _mm256_stream_si256((__m256i *)(dp + 64), v);
+            _mm256_stream_si256((__m256i *)(dp + 96), v);
+        }
+        _mm_sfence();
+    }
+
+    for (; dp + 96 < end; dp += 128)
+    {
+        _mm256_store_si256((__m256i *)dp, v);
+        _mm256_store_si256((__m256i *)(dp + 32), v);
+        _mm256_store_si256((__m256i *)(dp + 64), v);
+        _mm256_store_si256((__m256i *)(dp + 96), v);
+    }
+    for (; dp < end; dp += 32)
+    {
+        _mm256_store_si256((__m256i *)dp, v);
+    }
+}
+
+/*
+ * @brief AVX-512 fill kernel (64-byte broadcast)
+ * @param dest Destination memory address
+ * @param value Byte value to store
+ * @param count Number of bytes to set
+ *
+ * @note Time complexity: O(n) where n is count
+ */
+__attribute__((target("avx512f"))) static void
+mem_set_avx512(void *dest, int value, size_t count)
+{
+    unsigned char *d = (unsigned char *)dest;
+
+    if (count <= 64)
+    {
+        mem_set_avx2(dest, value, count);
+        return;
+    }
+
+    __m512i v = _mm512_set1_epi32((int)(0x01010101u * (unsigned char)value));
+    _mm512_storeu_si512((void *)d, v);
+    _mm512_storeu_si512((void *)(d + count - 64), v);
+
+    unsigned char *dp = (unsigned char *)(((uintptr_t)d + 64) & ~(uintptr_t)63);
+    unsigned char *end = d + count - 64;
+
+    if (count >= MEM_NONTEMPORAL_THRESHOLD)
+    {
+        for (; dp + 192 < end; dp += 256)
+        {
+            _mm512_stream_si512((void *)dp, v);
+            _mm512_stream_si512((void *)(dp + 64), v);
+            _mm512_stream_si512((void *)(dp + 128), v);
+            _mm512_stream_si512((void *)(dp + 192), v);
+        }
+        _mm_sfence();
+    }
+
+    for (; dp + 192 < end; dp += 256)
+    {
+        _mm512_store_si512((void *)dp, v);
+        _mm512_store_si512((void *)(dp + 64), v);
+        _mm512_store_si512((void *)(dp + 128), v);
+        _mm512_store_si512((void *)(dp + 192), v);
+    }
+    for (; dp < end; dp += 64)
+    {
+        _mm512_store_si512((void *)dp, v);
+    }
+}
+
+/*
+ * @brief Compares fewer than 16 bytes using 8-byte words
+ * @param a First memory region
+ * @param b Second memory region
+ * @param count Number of bytes to compare (less than 16)
+ * @return Difference of the first mismatching bytes, 0 if equal
+ *
+ * @note Time complexity: O(1)
+ * @note The lowest set bit of the XOR locates the first differing byte on
+ * little-endian x86
+ */
+static inline int mem_cmp_small(const unsigned char *a, const unsigned char *b,
+                                size_t count)
+{
+    if (count >= 8)
+    {
+        size_t offset = 0;
+        uint64_t diff = *(const mem_u64_t *)a ^ *(const mem_u64_t *)b;
+        if (diff == 0)
+        {
+            offset = count - 8;
+            diff = *(const mem_u64_t *)(a + offset) ^
+                   *(const mem_u64_t *)(b + offset);
+        }
+        if (diff == 0)
+        {
+            return 0;
+        }
+
+        size_t idx = offset + ((size_t)__builtin_ctzll(diff) >> 3);
+        return (int)a[idx] - (int)b[idx];
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (a[i] != b[i])
+        {
+            return (int)a[i] - (int)b[i];
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * @brief SSE2 comparison kernel (16-byte compare + movemask)
+ * @param ptr1 First memory region
+ * @param ptr2 Second memory region
+ * @param count Number of bytes to compare
+ * @return Difference of the first mismatching bytes, 0 if equal
+ *
+ * @note Time complexity: O(n) where n is count
+ * @note The final vector overlaps the previous one instead of a byte tail
+ */
+__attribute__((target("sse2"))) static int
+mem_cmp_sse2(const void *ptr1, const void *ptr2, size_t count)
+{
+    const unsigned char *a = (const unsigned char *)ptr1;
+    const unsigned char *b = (const unsigned char *)ptr2;
+
+    if (count < 16)
+    {
+        return mem_cmp_small(a, b, count);
+    }
+
+    size_t i = 0;
+    for (;;)
+    {
+        if (i + 16 > count)
+        {
+            i = count - 16;
+        }
+
+        __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i *)(b + i));
+        unsigned mask =
+            (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)) ^ 0xFFFFu;
+        if (mask != 0)
+        {
+            size_t idx = i + (size_t)__builtin_ctz(mask);
+            return (int)a[idx] - (int)b[idx];
+        }
+
+        if (i + 16 >= count)
+        {
+            return 0;
+        }
+        i += 16;
+    }
+}
+
+/*
+ * @brief AVX2 comparison kernel (32-byte compare + movemask)
+ * @param ptr1 First memory region
+ * @param ptr2 Second memory region
+ * @param count Number of bytes to compare
+ * @return Difference of the first mismatching bytes, 0 if equal
+ *
+ * @note Time complexity: O(n) where n is count
+ */
+__attribute__((target("avx2"))) static int
+mem_cmp_avx2(const void *ptr1, const void *ptr2, size_t count)
+{
+    const unsigned char *a = (const unsigned char *)ptr1;
+    const unsigned char *b = (const unsigned char *)ptr2;
+
+    if (count < 32)
+    {
+        return mem_cmp_sse2(ptr1, ptr2, count);
+    }
+
+    size_t i = 0;
+    for (;;)
+    {
+        if (i + 32 > count)
+        {
+            i = count - 32;
+        }
+
+        __m256i va = _mm256_loadu_si256((const __m256i *)(a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(b + i));
+        unsigned mask =
+            ~(unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb));
+        if (mask != 0)
+        {
+            size_t idx = i + (size_t)__builtin_ctz(mask);
+            return (int)a[idx] - (int)b[idx];
+        }
+
+        if (i + 32 >= count)
+        {
+            return 0;
+        }
+        i += 32;
+    }
+}
+
+/*
+ * @brief Checks fewer than 16 bytes for equality
+ * @param a First memory region
+ * @param b Second memory region
+ * @param count Number of bytes to compare (less than 16)
+ * @return true if both regions hold the same bytes
+ *
+ * @note Time complexity: O(1)
+ */
+static inline bool mem_eq_small(const unsigned char *a, const unsigned char *b,
+                                size_t count)
+{
+    if (count >= 8)
+    {
+        return ((*(const mem_u64_t *)a ^ *(const mem_u64_t *)b) |
+                (*(const mem_u64_t *)(a + count - 8) ^
+                 *(const mem_u64_t *)(b + count - 8))) == 0;
+    }
+    if (count >= 4)
+    {
+        return ((*(const mem_u32_t *)a ^ *(const mem_u32_t *)b) |
+                (*(const mem_u32_t *)(a + count - 4) ^
+                 *(const mem_u32_t *)(b + count - 4))) == 0;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (a[i] != b[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * @brief SSE2 equality kernel
+ * @param ptr1 First memory region
+ * @param ptr2 Second memory region
+ * @param count Number of bytes to compare
+ * @return true if both regions hold the same bytes
+ *
+ * @note Time complexity: O(n) where n is count
+ * @note ORs the XOR of four vectors per iteration and tests once, exiting on
+ * the first differing 64-byte block
+ */
+__attribute__((target("sse2"))) static bool
+mem_eq_sse2(const void *ptr1, const void *ptr2, size_t count)
+{
+    const unsigned char *a = (const unsigned char *)ptr1;
+    const unsigned char *b = (const unsigned char *)ptr2;
+
+    if (count < 16)
+    {
+        return mem_eq_small(a, b, count);
+    }
+
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (; i + 64 <= count; i += 64)
+    {
+        __m128i x0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(a + i)),
+                                   _mm_loadu_si128((const __m128i *)(b + i)));
+        __m128i x1 =
+            _mm_xor_si128(_mm_loadu_si128((const __m128i *)(a + i + 16)),
+                          _mm_loadu_si128((const __m128i *)(b + i + 16)));
+        __m128i x2 =
+            _mm_xor_si128(_mm_loadu_si128((const __m128i *)(a + i + 32)),
+                          _mm_loadu_si128((const __m128i *)(b + i + 32)));
+        __m128i x3 =
+            _mm_xor_si128(_mm_loadu_si128((const __m128i *)(a + i + 48)),
+                          _mm_loadu_si128((const __m128i *)(b + i + 48)));
+        __m128i any = _mm_or_si128(_mm_or_si128(x0, x1), _mm_or_si128(x2, x3));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(any, zero)) != 0xFFFF)
+        {
+            return false;
+        }
+    }
+
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i *)(b + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)) != 0xFFFF)
+        {
+            return false;
+        }
+    }
+
+    if (i < count)
+    {
+        __m128i va = _mm_loadu_si128((const __m128i *)(a + count - 16));
+        __m128i vb = _mm_loadu_si128((const __m128i *)(b + count - 16));
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)) == 0xFFFF;
+    }
+
+    return true;
+}
+
+/*
+ * @brief AVX2 equality kernel
+ * @param ptr1 First memory region
+ * @param ptr2 Second memory region
+ * @param count Number of bytes to compare
+ * @return true if both regions hold the same bytes
+ *
+ * @note Time complexity: O(n) where n is count
+ * @note Tests 128 bytes per iteration with a single vptest
+ */
+__attribute__((target("avx2"))) static bool
+mem_eq_avx2(const void *ptr1, const void *ptr2, size_t count)
+{
+    const unsigned char *a = (const unsigned char *)ptr1;
+    const unsigned char *b = (const unsigned char *)ptr2;
+
+    if (count < 32)
+    {
+        return mem_eq_sse2(ptr1, ptr2, count);
+    }
+
+    size_t i = 0;
+
+    for (; i + 128 <= count; i += 128)
+    {
+        __m256i x0 =
+            _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(a + i)),
+                             _mm256_loadu_si256((const __m256i *)(b + i)));
+        __m256i x1 =
+            _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(a + i + 32)),
+                             _mm256_loadu_si256((const __m256i *)(b + i + 32)));
+        __m256i x2 =
+            _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(a + i + 64)),
+                             _mm256_loadu_si256((const __m256i *)(b + i + 64)));
+        __m256i x3 =
+            _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(a + i + 96)),
+                             _mm256_loadu_si256((const __m256i *)(b + i + 96)));
+        __m256i any =
+            _mm256_or_si256(_mm256_or_si256(x0, x1), _mm256_or_si256(x2, x3));
+        if (!_mm256_testz_si256(any, any))
+        {
+            return false;
+        }
+    }
+
+    for (; i + 32 <= count; i += 32)
+    {
+        __m256i x =
+            _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(a + i)),
+                             _mm256_loadu_si256((const __m256i *)(b + i)));
+        if (!_mm256_testz_si256(x, x))
+        {
+            return false;
+        }
+    }
+
+    if (i < count)
+    {
+        __m256i x = _mm256_xor_si256(
+            _mm256_loadu_si256((const __m256i *)(a + count - 32)),
+            _mm256_loadu_si256((const __m256i *)(b + count - 32)));
+        return _mm256_testz_si256(x, x);
+    }
+
+    return true;
+}
+
+#endif /* CSTRUCTS_HAVE_X86_SIMD */
+
+/* ===== RUNTIME DISPATCH ===== */
+
+typedef void (*mem_move_kernel_t)(void *dest, const void *src, size_t count);
+typedef void (*mem_set_kernel_t)(void *dest, int value, size_t count);
+typedef int (*mem_cmp_kernel_t)(const void *ptr1, const void *ptr2,
+                                size_t count);
+typedef bool (*mem_eq_kernel_t)(const void *ptr1, const void *ptr2,
+                                size_t count);
+
+// Selected kernels; scalar until mem_dispatch_init runs
+static cpu_isa_t detected_isa = CPU_ISA_SCALAR;
+static mem_move_kernel_t mem_copy_kernel = mem_copy_scalar;
+static mem_move_kernel_t mem_move_kernel = mem_move_scalar;
+static mem_set_kernel_t mem_set_kernel = mem_set_scalar;
+static mem_cmp_kernel_t mem_cmp_kernel = mem_cmp_scalar;
+static mem_eq_kernel_t mem_eq_kernel = mem_eq_scalar;
+
+#if CSTRUCTS_HAVE_X86_SIMD
+
+/*
+ * @brief Detects the CPU's instruction set via cpuid
+ * @return Widest supported ISA level
+ *
+ * @note Time complexity: O(1)
+ * @note cpuid checks include OS support for the wider register state
+ */
+static cpu_isa_t cpu_isa_detect(void)
+{
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f"))
+        return CPU_ISA_AVX512;
+    if (__builtin_cpu_supports("avx2"))
+        return CPU_ISA_AVX2;
+    if (__builtin_cpu_supports("sse2"))
+        return CPU_ISA_SSE2;
+    return CPU_ISA_SCALAR;
+}
+
+/*
+ * @brief Selects memory kernels for the running CPU
+ *
+ * @note Time complexity: O(1)
+ * @note Runs once as a load-time constructor, so the function pointers are
+ * never written while other threads may read them
+ */
+__attribute__((constructor)) static void mem_dispatch_init(void)
+{
+    detected_isa = cpu_isa_detect();
+
+    switch (detected_isa)
+    {
+    case CPU_ISA_AVX512:
+        mem_copy_kernel = mem_move_avx512;
+        mem_move_kernel = mem_move_avx512;
+        mem_set_kernel = mem_set_avx512;
+        mem_cmp_kernel = mem_cmp_avx2;
+        mem_eq_kernel = mem_eq_avx2;
+        break;
+    case CPU_ISA_AVX2:
+        mem_copy_kernel = mem_move_avx2;
+        mem_move_kernel = mem_move_avx2;
+        mem_set_kernel = mem_set_avx2;
+        mem_cmp_kernel = mem_cmp_avx2;
+        mem_eq_kernel = mem_eq_avx2;
+        break;
+    case CPU_ISA_SSE2:
+        mem_copy_kernel = mem_move_sse2;
+        mem_move_kernel = mem_move_sse2;
+        mem_set_kernel = mem_set_sse2;
+        mem_cmp_kernel = mem_cmp_sse2;
+        mem_eq_kernel = mem_eq_sse2;
+        break;
+    default:
+        break;
+    }
+}
+
+#endif /* CSTRUCTS_HAVE_X86_SIMD */
+
+cpu_isa_t cpu_isa_level(void) { return detected_isa; }
+
+void cpu_relax(void)
+{
+#if CSTRUCTS_HAVE_X86_SIMD
+    __builtin_ia32_pause();
+#elif defined(__GNUC__) && (defined(__aarch64__) || defined(__arm__))
+    __asm__ __volatile__("yield");
+#endif
+}
+
+void thread_yield(void)
+{
+#if CSTRUCTS_HAVE_SCHED_YIELD
+    sched_yield();
+#endif
+}
+
+/* ===== MEMORY OPERATIONS IMPLEMENTATION ===== */
+
+void *mem_copy(void *dest, const void *src, size_t count)
+{
+    if (dest == NULL || src == NULL || count == 0)
+    {
+        return dest;
+    }
+
+    mem_copy_kernel(dest, src, count);
+    return dest;
+}
+
+void *mem_set(void *dest, int value, size_t count)
+{
+    if (dest == NULL || count == 0)
+    {
+        return dest;
+    }
+
+    mem_set_kernel(dest, value, count);
+    return dest;
+}
+
+int mem_cmp(const void *ptr1, const void *ptr2, size_t count)
+{
+    if (ptr1 == NULL || ptr2 == NULL)
+    {
+        fprintf(stderr, "ERROR: mem_cmp called with NULL pointer\n");
+        return 0;
+    }
+
+    if (count == 0)
+        return 0;
+
+    return mem_cmp_kernel(ptr1, ptr2, count);
+}
+
+bool mem_eq(const void *ptr1, const void *ptr2, size_t count)
+{
+    if (ptr1 == NULL || ptr2 == NULL)
+    {
+        fprintf(stderr, "ERROR: mem_eq called with NULL pointer\n");
+        return false;
+    }
+
+    if (count == 0 || ptr1 == ptr2)
+        return true;
+
+    return mem_eq_kernel(ptr1, ptr2, count);
+}
+
+void *mem_move(void *dest, const void *src, size_t count)
+{
+    if (dest == NULL || src == NULL || count == 0)
+    {
+        return dest;
+    }
+
+    mem_move_kernel(dest, src, count);
+    return dest;
+}
+
+/* ===== UTILITY FUNCTIONS IMPLEMENTATION ===== */
+
+/*
+ * @brief Swaps two regions in registers, one word at a time
+ * @param a First region
+ * @param b Second region
+ * @param size Number of bytes to swap
+ *
+ * @note Time complexity: O(n) where n is size
+ * @note No temporary buffer; the compiler unrolls this for constant sizes
+ */
+static inline void mem_swap_words(unsigned char *a, unsigned char *b,
+                                  size_t size)
+{
+    size_t i = 0;
+
+#if defined(__GNUC__)
+    for (; i + 8 <= size; i += 8)
+    {
+        uint64_t temp = *(mem_u64_t *)(a + i);
+        *(mem_u64_t *)(a + i) = *(mem_u64_t *)(b + i);
+        *(mem_u64_t *)(b + i) = temp;
+    }
+#endif
+
+    for (; i < size; i++)
+    {
+        unsigned char temp = a[i];
+        a[i] = b[i];
+        b[i] = temp;
+    }
+}
+
+void mem_swap(void *a, void *b, size_t size)
+{
+    if (a == NULL || b == NULL || size == 0 || a == b)
+    {
+        return;
+    }
+
+    unsigned char *pa = (unsigned char *)a;
+    unsigned char *pb = (unsigned char *)b;
+
+    // Size-specialized paths for common element sizes
+    switch (size)
+    {
+#if defined(__GNUC__)
+    case 4:
+    {
+        uint32_t temp = *(mem_u32_t *)pa;
+        *(mem_u32_t *)pa = *(mem_u32_t *)pb;
+        *(mem_u32_t *)pb = temp;
+        return;
+    }
+    case 8:
+    {
+        uint64_t temp = *(mem_u64_t *)pa;
+        *(mem_u64_t *)pa = *(mem_u64_t *)pb;
+        *(mem_u64_t *)pb = temp;
+        return;
+    }
+#endif
+    case 16:
+        mem_swap_words(pa, pb, 16);
+        return;
+    case 32:
+        mem_swap_words(pa, pb, 32);
+        return;
+    default:
+        break;
+    }
+
+    if (size < 64)
+    {
+        mem_swap_words(pa, pb, size);
+        return;
+    }
+
+    // Large elements: exchange in fixed stack chunks through the SIMD kernels
+    unsigned char temp[MEM_SWAP_CHUNK];
+    while (size > 0)
+    {
+        size_t chunk = size < MEM_SWAP_CHUNK ? size : MEM_SWAP_CHUNK;
+        mem_copy_kernel(temp, pa, chunk);
+        mem_copy_kernel(pa, pb, chunk);
+        mem_copy_kernel(pb, temp, chunk);
+        pa += chunk;
+        pb += chunk;
+        size -= chunk;
+    }
+}
+
+int cmp_max(int a, int b) { return (a > b) ? a : b; }
+
+int cmp_min(int a, int b) { return (a < b) ? a : b; }
+
+size_t next_power_of_two(size_t value)
+{
+    if (value <= 1)
+    {
+        return 1;
+    }
+
+    // Smear the highest set bit of value - 1 into every lower bit
+    value--;
+    for (size_t shift = 1; shift < sizeof(size_t) * 8; shift <<= 1)
+    {
+        value |= value >> shift;
+    }
+
+    return value + 1; // Wraps to 0 when no power of two fits
+}
+
+/* ===== COMPARISON FUNCTIONS IMPLEMENTATION ===== */
+
+int cmp_fn_int(const void *a, const void *b)
+{
+    const int *int_a = (const int *)a;
+    const int *int_b = (const int *)b;
+
+    if (*int_a < *int_b)
+        return -1;
+    if (*int_a > *int_b)
+        return 1;
+    return 0;
+}
+
+int cmp_fn_float(const void *a, const void *b)
+{
+    const float *float_a = (const float *)a;
+    const float *float_b = (const float *)b;
+
+    if (*float_a < *float_b)
+        return -1;
+    if (*float_a > *float_b)
+        return 1;
+    return 0;
+}
+
+int cmp_fn_double(const void *a, const void *b)
+{
+    const double *double_a = (const double *)a;
+    const double *double_b = (const double *)b;
+
+    if (*double_a < *double_b)
+        return -1;
+    if (*double_a > *double_b)
+        return 1;
+    return 0;
+}
+
+int cmp_fn_string(const void *a, const void *b)
+{
+    const char *str_a = *(const char **)a;
+    const char *str_b = *(const char **)b;
+
+    if (str_a == NULL && str_b == NULL)
+        return 0;
+    if (str_a == NULL)
+        return -1;
+    if (str_b == NULL)
+        return 1;
+
+    // Compare strings character by character
+    while (*str_a && *str_b && *str_a == *str_b)
+    {
+        str_a++;
+        str_b++;
+    }
+
+    return (*str_a > *str_b) - (*str_a < *str_b);
+}
+
+/* ===== HASH FUNCTIONS IMPLEMENTATION ===== */
+
+// XXH64 primes
+#define HASH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define HASH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define HASH_PRIME64_3 0x165667B19E3779F9ULL
+#define HASH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define HASH_PRIME64_5 0x27D4EB2F165667C5ULL
+
+#define HASH_STRIPE 32 // Bytes consumed per round by the four lanes
+
+static inline uint64_t hash_rotl64(uint64_t value, unsigned shift)
+{
+    return (value << shift) | (value >> (64 - shift));
+}
+
+/*
+ * @brief Reads a little-endian 64-bit word from any address
+ */
+static inline uint64_t hash_read64(const unsigned char *p)
+{
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) &&                            \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    return *(const mem_u64_t *)p;
+#else
+    return (uint64_t)p[0] | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16) |
+           ((uint64_t)p[3] << 24) | ((uint64_t)p[4] << 32) |
+           ((uint64_t)p[5] << 40) | ((uint64_t)p[6] << 48) |
+           ((uint64_t)p[7] << 56);
+#endif
+}
+
+/*
+ * @brief Reads a little-endian 32-bit word from any address
+ */
+static inline uint32_t hash_read32(const unsigned char *p)
+{
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) &&                            \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    return *(const mem_u32_t *)p;
+#else
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+           ((uint32_t)p[3] << 24);
+#endif
+}
+
+/*
+ * @brief Folds one 8-byte input into a lane accumulator
+ */
+static inline uint64_t hash_round(uint64_t acc, uint64_t input)
+{
+    acc += input * HASH_PRIME64_2;
+    acc = hash_rotl64(acc, 31);
+    return acc * HASH_PRIME64_1;
+}
+
+/*
+ * @brief Merges a lane accumulator into the final hash
+ */
+static inline uint64_t hash_merge_round(uint64_t hash, uint64_t acc)
+{
+    hash ^= hash_round(0, acc);
+    return hash * HASH_PRIME64_1 + HASH_PRIME64_4;
+}
+
+/*
+ * @brief Consumes whole stripes into the four lane accumulators
+ * @param acc Lane accumulators
+ * @param p First byte
+ * @param stripes Number of 32-byte stripes
+ */
+static void hash_stripes(uint64_t acc[4], const unsigned char *p,
+                         size_t stripes)
+{
+    uint64_t v1 = acc[0], v2 = acc[1], v3 = acc[2], v4 = acc[3];
+
+    // Four independent lanes keep the multipliers busy in parallel
+    while (stripes-- > 0)
+    {
+        v1 = hash_round(v1, hash_read64(p));
+        v2 = hash_round(v2, hash_read64(p + 8));
+        v3 = hash_round(v3, hash_read64(p + 16));
+        v4 = hash_round(v4, hash_read64(p + 24));
+        p += HASH_STRIPE;
+    }
+
+    acc[0] = v1;
+    acc[1] = v2;
+    acc[2] = v3;
+    acc[3] = v4;
+}
+
+/*
+ * @brief Sets the lane accumulators for a seed
+ */
+static void hash_lanes_init(uint64_t acc[4], uint64_t seed)
+{
+    acc[0] = seed + HASH_PRIME64_1 + HASH_PRIME64_2;
+    acc[1] = seed + HASH_PRIME64_2;
+    acc[2] = seed;
+    acc[3] = seed - HASH_PRIME64_1;
+}
+
+/*
+ * @brief Collapses the four lanes into one value
+ */
+static uint64_t hash_lanes_merge(const uint64_t acc[4])
+{
+    uint64_t hash = hash_rotl64(acc[0], 1) + hash_rotl64(acc[1], 7) +
+                    hash_rotl64(acc[2], 12) + hash_rotl64(acc[3], 18);
+    hash = hash_merge_round(hash, acc[0]);
+    hash = hash_merge_round(hash, acc[1]);
+    hash = hash_merge_round(hash, acc[2]);
+    return hash_merge_round(hash, acc[3]);
+}
+
+/*
+ * @brief Mixes in the final (< 32) bytes and avalanches the result
+ * @param hash Hash so far
+ * @param p Remaining bytes
+ * @param length Number of remaining bytes
+ * @return Final hash
+ */
+static uint64_t hash_finalize(uint64_t hash, const unsigned char *p,
+                              size_t length)
+{
+    while (length >= 8)
+    {
+        hash ^= hash_round(0, hash_read64(p));
+        hash = hash_rotl64(hash, 27) * HASH_PRIME64_1 + HASH_PRIME64_4;
+        p += 8;
+        length -= 8;
+    }
+
+    if (length >= 4)
+    {
+        hash ^= (uint64_t)hash_read32(p) * HASH_PRIME64_1;
+        hash = hash_rotl64(hash, 23) * HASH_PRIME64_2 + HASH_PRIME64_3;
+        p += 4;
+        length -= 4;
+    }
+
+    while (length > 0)
+    {
+        hash ^= (uint64_t)(*p) * HASH_PRIME64_5;
+        hash = hash_rotl64(hash, 11) * HASH_PRIME64_1;
+        p++;
+        length--;
+    }
+
+    // Avalanche so every input bit affects every output bit
+    hash ^= hash >> 33;
+    hash *= HASH_PRIME64_2;
+    hash ^= hash >> 29;
+    hash *= HASH_PRIME64_3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
+uint64_t hash_bytes(const void *data, size_t length, uint64_t seed)
+{
+    if (data == NULL && length > 0)
+    {
+        fprintf(stderr, "Error: NULL pointer passed to hash_bytes\n");
+        return 0;
+    }
+
+    const unsigned char *p = (const unsigned char *)data;
+    uint64_t hash;
+
+    if (length >= HASH_STRIPE)
+    {
+        uint64_t acc[4];
+        hash_lanes_init(acc, seed);
+        hash_stripes(acc, p, length / HASH_STRIPE);
+        hash = hash_lanes_merge(acc);
+        p += length - length % HASH_STRIPE;
+    }
+    else
+    {
+        hash = seed + HASH_PRIME64_5;
+    }
+
+    hash += (uint64_t)length;
+    return hash_finalize(hash, p, length % HASH_STRIPE);
+}
+
+uint64_t hash_string(const char *str, uint64_t seed)
+{
+    if (str == NULL)
+    {
+        return hash_u64(0, seed ^ HASH_PRIME64_3);
+    }
+
+    size_t length = 0;
+    while (str[length] != '\0')
+    {
+        length++;
+    }
+
+    return hash_bytes(str, length, seed);
+}
+
+uint64_t hash_u64(uint64_t value, uint64_t seed)
+{
+    // splitmix64 finalizer: invertible multiply-xorshift steps
+    value += seed + 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+uint32_t hash_u32(uint32_t value, uint32_t seed)
+{
+    // lowbias32: two multiply-xorshift steps with full 32-bit avalanche
+    value ^= seed;
+    value ^= value >> 16;
+    value *= 0x7FEB352DU;
+    value ^= value >> 15;
+    value *= 0x846CA68BU;
+    value ^= value >> 16;
+    return value;
+}
+
+void hash_state_init(hash_state_t *state, uint64_t seed)
+{
+    if (state == NULL)
+    {
+        fprintf(stderr, "Error: NULL pointer passed to hash_state_init\n");
+        return;
+    }
+
+    hash_lanes_init(state->acc, seed);
+    state->total_length = 0;
+    state->seed = seed;
+    state->buffered = 0;
+}
+
+void hash_state_update(hash_state_t *state, const void *data, size_t length)
+{
+    if (state == NULL || (data == NULL && length > 0))
+    {
+        fprintf(stderr, "Error: NULL pointer passed to hash_state_update\n");
+        return;
+    }
+
+    const unsigned char *p = (const unsigned char *)data;
+    state->total_length += length;
+
+    // Top up a partial stripe left by the previous update
+    if (state->buffered > 0)
+    {
+        size_t fill = HASH_STRIPE - state->buffered;
+        if (fill > length)
+        {
+            fill = length;
+        }
+
+        mem_copy(state->buffer + state->buffered, p, fill);
+        state->buffered += fill;
+        p += fill;
+        length -= fill;
+
+        if (state->buffered < HASH_STRIPE)
+        {
+            return;
+        }
+
+        hash_stripes(state->acc, state->buffer, 1);
+        state->buffered = 0;
+    }
+
+    // Whole stripes go straight from the caller's buffer
+    size_t stripes = length / HASH_STRIPE;
+    hash_stripes(state->acc, p, stripes);
+    p += stripes * HASH_STRIPE;
+    length -= stripes * HASH_STRIPE;
+
+    if (length > 0)
+    {
+        mem_copy(state->buffer, p, length);
+        state->buffered = length;
+    }
+}
+
+uint64_t hash_state_digest(const hash_state_t *state)
+{
+    if (state == NULL)
+    {
+        fprintf(stderr, "Error: NULL pointer passed to hash_state_digest\n");
+        return 0;
+    }
+
+    uint64_t hash;
+    if (state->total_length >= HASH_STRIPE)
+    {
+        hash = hash_lanes_merge(state->acc);
+    }
+    else
+    {
+        hash = state->seed + HASH_PRIME64_5;
+    }
+
+    hash += state->total_length;
+    return hash_finalize(hash, state->buffer, state->buffered);
+}
+
+uint64_t hash_fn_int(const void *key)
+{
+    return hash_u64((uint64_t)(unsigned int)*(const int *)key,
+                    HASH_DEFAULT_SEED);
+}
+
+uint64_t hash_fn_float(const void *key)
+{
+    // -0.0f == +0.0f, so both must hash like +0.0f
+    float value = *(const float *)key;
+    if (value == 0.0f)
+    {
+        value = 0.0f;
+    }
+    uint32_t bits;
+    mem_copy(&bits, &value, sizeof(bits));
+    return hash_u64(bits, HASH_DEFAULT_SEED);
+}
+
+uint64_t hash_fn_double(const void *key)
+{
+    // -0.0 == +0.0, so both must hash like +0.0
+    double value = *(const double *)key;
+    if (value == 0.0)
+    {
+        value = 0.0;
+    }
+    uint64_t bits;
+    mem_copy(&bits, &value, sizeof(bits));
+    return hash_u64(bits, HASH_DEFAULT_SEED);
+}
+
+uint64_t hash_fn_string(const void *key)
+{
+    return hash_string(*(const char *const *)key, HASH_DEFAULT_SEED);
 }
 
 /* ===== DEBUGGING AND ERROR HANDLING IMPLEMENTATION ===== */
@@ -12,33 +12,82 @@
 #include "../../include/module 2/vector.h"
 #include <stdio.h>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#include <unistd.h>
+#define CSTRUCTS_HAVE_PTHREADS 1
+#else
+#define CSTRUCTS_HAVE_PTHREADS 0
+#endif
+
+#if CSTRUCTS_HAVE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+/* ===== CONSTANTS ===== */
+
+#define VECTOR_SORT_INSERTION_THRESHOLD 16 // Ranges this short use insertion
+#define VECTOR_RADIX_BITS 8                // Key bits consumed per pass
+#define VECTOR_RADIX_BUCKETS (1u << VECTOR_RADIX_BITS)
+#define VECTOR_PARALLEL_MIN_CHUNK 16384    // Fewest elements worth a thread
+#define VECTOR_NUMERIC_BLOCK 4096          // Elements per argmin/argmax block
+#define VECTOR_COUNT_FLUSH ((size_t)1 << 24) // Vectors per 32-bit lane count
+
+#if defined(__GNUC__)
+// Element and key accesses that may alias any type and be unaligned
+typedef uint32_t __attribute__((may_alias, aligned(1))) vector_u32_t;
+typedef uint64_t __attribute__((may_alias, aligned(1))) vector_u64_t;
+#endif
+
 /* ===== PRIVATE HELPER FUNCTIONS ===== */
 
 /*
- * @brief Checks if vector needs to grow and resizes if necessary
+ * @brief Makes room for at least the given number of elements
  * @param vector Target vector
+ * @param min_capacity Number of elements that must fit
  * @return SUCCESS on success, error code on failure
  *
  * @note Time complexity: O(1) for check, O(n) for resize if needed
- * @note Automatically grows by VECTOR_GROWTH_FACTOR when capacity is reached
+ * @note Grows by at least VECTOR_GROWTH_FACTOR so repeated calls stay
+ * amortized O(1) per element
  * @note Ensures minimum capacity is at least VECTOR_INITIAL_CAPACITY
  */
-static status_t vector_check_grow(vector_t *vector)
+static status_t vector_grow_to(vector_t *vector, size_t min_capacity)
 {
-    if (vector->size >= vector->capacity)
+    if (min_capacity <= vector->capacity)
     {
-        size_t new_capacity = vector->capacity * VECTOR_GROWTH_FACTOR;
-        if (new_capacity < VECTOR_INITIAL_CAPACITY)
-        {
-            new_capacity = VECTOR_INITIAL_CAPACITY;
-        }
-        if (new_capacity <= vector->capacity)
-        {
-            new_capacity = vector->capacity + 1;
-        }
-        return vector_reserve(vector, new_capacity);
+        return SUCCESS;
     }
-    return SUCCESS;
+
+    if (min_capacity > SIZE_MAX / vector->element_size)
+    {
+        return ERROR_MEMORY_ALLOCATION;
+    }
+
+    size_t new_capacity = vector->capacity * VECTOR_GROWTH_FACTOR;
+    if (new_capacity < VECTOR_INITIAL_CAPACITY)
+    {
+        new_capacity = VECTOR_INITIAL_CAPACITY;
+    }
+    if (new_capacity < min_capacity ||
+        new_capacity > SIZE_MAX / vector->element_size)
+    {
+        new_capacity = min_capacity;
+    }
+    return vector_reserve(vector, new_capacity);
+}
+
+/*
+ * @brief Checks if vector needs to grow and resizes if necessary
+ * @param vector Target vector
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(1) for check, O(n) for resize if needed
+ * @note Automatically grows by VECTOR_GROWTH_FACTOR when capacity is reached
+ */
+static status_t vector_check_grow(vector_t *vector)
+{
+    return vector_grow_to(vector, vector->size + 1);
 }
 
 /*
@@ -75,6 +124,13 @@ vector_t *vector_create(size_t element_size)
 
 vector_t *vector_create_with_capacity(size_t element_size,
                                       size_t initial_capacity)
+{
+    return vector_create_with_allocator(element_size, initial_capacity, NULL);
+}
+
+vector_t *vector_create_with_allocator(size_t element_size,
+                                       size_t initial_capacity,
+                                       const allocator_t *allocator)
 {
     if (element_size == 0)
     {
@@ -87,22 +143,29 @@ vector_t *vector_create_with_capacity(size_t element_size,
         initial_capacity = VECTOR_INITIAL_CAPACITY;
     }
 
-    vector_t *vector = (vector_t *)mem_alloc(sizeof(vector_t));
+    if (allocator == NULL)
+    {
+        allocator = allocator_default();
+    }
+
+    vector_t *vector =
+        (vector_t *)allocator_alloc(allocator, sizeof(vector_t));
     if (vector == NULL)
     {
         return NULL;
     }
 
-    vector->data = mem_alloc(element_size * initial_capacity);
+    vector->data = allocator_alloc(allocator, element_size * initial_capacity);
     if (vector->data == NULL)
     {
-        mem_free((void **)&vector);
+        allocator_free(allocator, vector, sizeof(vector_t));
         return NULL;
     }
 
     vector->size = 0;
     vector->capacity = initial_capacity;
     vector->element_size = element_size;
+    vector->allocator = *allocator;
 
     return vector;
 }
@@ -111,8 +174,11 @@ void vector_destroy(vector_t *vector)
 {
     if (vector != NULL)
     {
-        mem_free((void **)&vector->data);
-        mem_free((void **)&vector);
+        // Copy the allocator out: it lives inside the block being freed
+        allocator_t allocator = vector->allocator;
+        allocator_free(&allocator, vector->data,
+                       vector->capacity * vector->element_size);
+        allocator_free(&allocator, vector, sizeof(vector_t));
     }
 }
 
@@ -123,23 +189,18 @@ vector_t *vector_copy(const vector_t *src)
         return NULL;
     }
 
-    vector_t *dest =
-        vector_create_with_capacity(src->element_size, src->capacity);
+    vector_t *dest = vector_create_with_allocator(
+        src->element_size, src->capacity, &src->allocator);
     if (dest == NULL)
     {
         return NULL;
     }
 
-    // Copy all elements
-    for (size_t i = 0; i < src->size; i++)
+    // Copy all elements at once
+    if (vector_append_n(dest, src->data, src->size) != SUCCESS)
     {
-        const void *element = (const char *)src->data + (i * src->element_size);
-        status_t result = vector_push_back(dest, element);
-        if (result != SUCCESS)
-        {
-            vector_destroy(dest);
-            return NULL;
-        }
+        vector_destroy(dest);
+        return NULL;
     }
 
     return dest;
@@ -263,6 +324,81 @@ status_t vector_remove(vector_t *vector, size_t index)
     return SUCCESS;
 }
 
+status_t vector_swap_remove(vector_t *vector, size_t index)
+{
+    if (vector == NULL)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    status_t result = vector_check_index(vector, index);
+    if (result != SUCCESS)
+    {
+        return result;
+    }
+
+    // Fill the hole with the last element instead of shifting the tail
+    size_t last = vector->size - 1;
+    if (index != last)
+    {
+        mem_copy((char *)vector->data + (index * vector->element_size),
+                 (char *)vector->data + (last * vector->element_size),
+                 vector->element_size);
+    }
+
+    vector->size--;
+    return SUCCESS;
+}
+
+size_t vector_remove_if(vector_t *vector,
+                        bool (*pred)(const void *element, void *context),
+                        void *context)
+{
+    if (vector == NULL || pred == NULL)
+    {
+        return 0;
+    }
+
+    char *data = (char *)vector->data;
+    size_t width = vector->element_size;
+    size_t size = vector->size;
+
+    // Nothing moves until the first removal
+    size_t write = 0;
+    while (write < size && !pred(data + write * width, context))
+    {
+        write++;
+    }
+
+    size_t read = write + 1;
+    while (read < size)
+    {
+        if (pred(data + read * width, context))
+        {
+            read++;
+            continue;
+        }
+
+        // Slide the whole run of survivors down in one move
+        size_t run = read;
+        do
+        {
+            read++;
+        } while (read < size && !pred(data + read * width, context));
+
+        mem_move(data + write * width, data + run * width,
+                 (read - run) * width);
+        write += read - run;
+
+        // The element that ended the run matched (or the vector ended)
+        read++;
+    }
+
+    size_t removed = write < size ? size - write : 0;
+    vector->size -= removed;
+    return removed;
+}
+
 void vector_clear(vector_t *vector)
 {
     if (vector != NULL)
@@ -271,6 +407,152 @@ void vector_clear(vector_t *vector)
     }
 }
 
+/* ===== BULK OPERATIONS ===== */
+
+status_t vector_append_n(vector_t *vector, const void *elements,
+                         size_t count)
+{
+    return vector_insert_range(vector, vector != NULL ? vector->size : 0,
+                               elements, count);
+}
+
+status_t vector_insert_range(vector_t *vector, size_t index,
+                             const void *elements, size_t count)
+{
+    if (vector == NULL || (elements == NULL && count > 0))
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (index > vector->size)
+    {
+        return ERROR_INDEX_OUT_OF_BOUNDS;
+    }
+
+    if (count == 0)
+    {
+        return SUCCESS;
+    }
+
+    if (count > SIZE_MAX - vector->size)
+    {
+        return ERROR_MEMORY_ALLOCATION;
+    }
+
+    status_t result = vector_grow_to(vector, vector->size + count);
+    if (result != SUCCESS)
+    {
+        return result;
+    }
+
+    // Shift the tail once to open a gap for the whole batch
+    char *gap = (char *)vector->data + (index * vector->element_size);
+    size_t bytes = count * vector->element_size;
+    if (index < vector->size)
+    {
+        mem_move(gap + bytes, gap,
+                 (vector->size - index) * vector->element_size);
+    }
+
+    mem_copy(gap, elements, bytes);
+    vector->size += count;
+
+    return SUCCESS;
+}
+
+status_t vector_erase_range(vector_t *vector, size_t index, size_t count)
+{
+    if (vector == NULL)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (index > vector->size || count > vector->size - index)
+    {
+        return ERROR_INDEX_OUT_OF_BOUNDS;
+    }
+
+    // Close the gap with a single shift of the tail
+    size_t tail = vector->size - index - count;
+    if (count > 0 && tail > 0)
+    {
+        char *gap = (char *)vector->data + (index * vector->element_size);
+        mem_move(gap, gap + count * vector->element_size,
+                 tail * vector->element_size);
+    }
+
+    vector->size -= count;
+    return SUCCESS;
+}
+
+status_t vector_assign(vector_t *vector, const void *elements, size_t count)
+{
+    if (vector == NULL || (elements == NULL && count > 0))
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    status_t result = vector_grow_to(vector, count);
+    if (result != SUCCESS)
+    {
+        return result;
+    }
+
+    if (count > 0)
+    {
+        mem_copy(vector->data, elements, count * vector->element_size);
+    }
+    vector->size = count;
+
+    return SUCCESS;
+}
+
+/* ===== IN-PLACE CONSTRUCTION ===== */
+
+void *vector_emplace_back(vector_t *vector)
+{
+    if (vector == NULL || vector_check_grow(vector) != SUCCESS)
+    {
+        return NULL;
+    }
+
+    void *slot = (char *)vector->data + (vector->size * vector->element_size);
+    vector->size++;
+
+    return slot;
+}
+
+void *vector_reserve_tail(vector_t *vector, size_t count)
+{
+    if (vector == NULL || count > SIZE_MAX - vector->size)
+    {
+        return NULL;
+    }
+
+    if (vector_grow_to(vector, vector->size + count) != SUCCESS)
+    {
+        return NULL;
+    }
+
+    return (char *)vector->data + (vector->size * vector->element_size);
+}
+
+status_t vector_commit(vector_t *vector, size_t count)
+{
+    if (vector == NULL)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (count > vector->capacity - vector->size)
+    {
+        return ERROR_INDEX_OUT_OF_BOUNDS;
+    }
+
+    vector->size += count;
+    return SUCCESS;
+}
+
 /* ===== ELEMENT ACCESS ===== */
 
 status_t vector_get(const vector_t *vector, size_t index, void *output)
@@ -390,8 +672,10 @@ status_t vector_reserve(vector_t *vector, size_t new_capacity)
         return SUCCESS; // No need to reserve less capacity
     }
 
-    void *new_data =
-        mem_realloc(vector->data, new_capacity * vector->element_size);
+    void *new_data = allocator_realloc(
+        &vector->allocator, vector->data,
+        vector->capacity * vector->element_size,
+        new_capacity * vector->element_size);
     if (new_data == NULL)
     {
         return ERROR_MEMORY_ALLOCATION;
@@ -417,13 +701,17 @@ status_t vector_shrink_to_fit(vector_t *vector)
 
     if (vector->size == 0)
     {
-        mem_free((void **)&vector->data);
+        allocator_free(&vector->allocator, vector->data,
+                       vector->capacity * vector->element_size);
+        vector->data = NULL;
         vector->capacity = 0;
         return SUCCESS;
     }
 
-    void *new_data =
-        mem_realloc(vector->data, vector->size * vector->element_size);
+    void *new_data = allocator_realloc(
+        &vector->allocator, vector->data,
+        vector->capacity * vector->element_size,
+        vector->size * vector->element_size);
     if (new_data == NULL)
     {
         return ERROR_MEMORY_ALLOCATION;
@@ -468,6 +756,13 @@ void vector_swap(vector_t *a, vector_t *b)
         return;
     }
 
+    if (!allocator_equal(&a->allocator, &b->allocator))
+    {
+        fprintf(stderr, "Error: Cannot swap vectors with different "
+                        "allocators\n");
+        return;
+    }
+
     // Swap all fields
     void *temp_data = a->data;
     a->data = b->data;
@@ -486,6 +781,2019 @@ void vector_swap(vector_t *a, vector_t *b)
     b->element_size = temp_element_size;
 }
 
+/* ===== SORTING HELPERS ===== */
+
+/*
+ * @brief Swaps two elements, in registers for common sizes
+ * @param a First element
+ * @param b Second element
+ * @param width Element size in bytes
+ *
+ * @note The switch is on a value fixed for the whole sort, so it predicts
+ * perfectly and beats a call into mem_swap for every exchange
+ */
+static inline void vector_sort_swap(unsigned char *a, unsigned char *b,
+                                    size_t width)
+{
+#if defined(__GNUC__)
+    switch (width)
+    {
+    case 4:
+    {
+        uint32_t temp = *(vector_u32_t *)a;
+        *(vector_u32_t *)a = *(vector_u32_t *)b;
+        *(vector_u32_t *)b = temp;
+        return;
+    }
+    case 8:
+    {
+        uint64_t temp = *(vector_u64_t *)a;
+        *(vector_u64_t *)a = *(vector_u64_t *)b;
+        *(vector_u64_t *)b = temp;
+        return;
+    }
+    case 16:
+    {
+        uint64_t low = *(vector_u64_t *)a;
+        uint64_t high = *(vector_u64_t *)(a + 8);
+        *(vector_u64_t *)a = *(vector_u64_t *)b;
+        *(vector_u64_t *)(a + 8) = *(vector_u64_t *)(b + 8);
+        *(vector_u64_t *)b = low;
+        *(vector_u64_t *)(b + 8) = high;
+        return;
+    }
+    default:
+        break;
+    }
+#endif
+    mem_swap(a, b, width);
+}
+
+/*
+ * @brief Copies one element, in registers for common sizes
+ * @param dest Destination element
+ * @param src Source element
+ * @param width Element size in bytes
+ */
+static inline void vector_sort_move(unsigned char *dest,
+                                    const unsigned char *src, size_t width)
+{
+#if defined(__GNUC__)
+    switch (width)
+    {
+    case 4:
+        *(vector_u32_t *)dest = *(const vector_u32_t *)src;
+        return;
+    case 8:
+        *(vector_u64_t *)dest = *(const vector_u64_t *)src;
+        return;
+    case 16:
+        *(vector_u64_t *)dest = *(const vector_u64_t *)src;
+        *(vector_u64_t *)(dest + 8) = *(const vector_u64_t *)(src + 8);
+        return;
+    default:
+        break;
+    }
+#endif
+    mem_copy(dest, src, width);
+}
+
+/*
+ * @brief Sorts a short range by insertion
+ * @param base First element
+ * @param count Number of elements
+ * @param width Element size in bytes
+ * @param cmp Comparison function
+ *
+ * @note Time complexity: O(n^2), used only below the insertion threshold
+ */
+static void vector_insertion_sort(unsigned char *base, size_t count,
+                                  size_t width, cmp_fn cmp)
+{
+    for (size_t i = 1; i < count; i++)
+    {
+        unsigned char *current = base + i * width;
+        while (current > base && cmp(current - width, current) > 0)
+        {
+            vector_sort_swap(current - width, current, width);
+            current -= width;
+        }
+    }
+}
+
+/*
+ * @brief Sorts a range by heapsort
+ * @param base First element
+ * @param count Number of elements
+ * @param width Element size in bytes
+ * @param cmp Comparison function
+ *
+ * @note Time complexity: O(n log n); introsort's guard against bad pivots
+ */
+static void vector_heap_sort(unsigned char *base, size_t count, size_t width,
+                             cmp_fn cmp)
+{
+    for (size_t end = count, start = count / 2; end > 1;)
+    {
+        size_t root;
+        if (start > 0)
+        {
+            root = --start; // Building the heap
+        }
+        else
+        {
+            end--; // Moving the maximum behind the heap
+            vector_sort_swap(base, base + end * width, width);
+            root = 0;
+        }
+
+        for (size_t child = 2 * root + 1; child < end; child = 2 * root + 1)
+        {
+            if (child + 1 < end &&
+                cmp(base + child * width, base + (child + 1) * width) < 0)
+            {
+                child++;
+            }
+            if (cmp(base + root * width, base + child * width) >= 0)
+            {
+                break;
+            }
+            vector_sort_swap(base + root * width, base + child * width,
+                             width);
+            root = child;
+        }
+    }
+}
+
+/*
+ * @brief Introsort over a range
+ * @param base First element
+ * @param count Number of elements
+ * @param width Element size in bytes
+ * @param cmp Comparison function
+ * @param depth Partitioning levels left before falling back to heapsort
+ *
+ * @note Recurses into the smaller side and loops on the larger, so the
+ * stack stays O(log n)
+ */
+static void vector_introsort(unsigned char *base, size_t count, size_t width,
+                             cmp_fn cmp, size_t depth)
+{
+    while (count > VECTOR_SORT_INSERTION_THRESHOLD)
+    {
+        if (depth == 0)
+        {
+            vector_heap_sort(base, count, width, cmp);
+            return;
+        }
+        depth--;
+
+        // Order first, middle and last, then use the median as pivot
+        unsigned char *middle = base + (count / 2) * width;
+        unsigned char *last = base + (count - 1) * width;
+        if (cmp(middle, base) < 0)
+            vector_sort_swap(middle, base, width);
+        if (cmp(last, middle) < 0)
+        {
+            vector_sort_swap(last, middle, width);
+            if (cmp(middle, base) < 0)
+                vector_sort_swap(middle, base, width);
+        }
+        vector_sort_swap(base, middle, width);
+
+        // Hoare partition around base; stopping on equal keys keeps runs of
+        // duplicates balanced
+        size_t i = 1;
+        size_t j = count - 1;
+        for (;;)
+        {
+            while (i <= j && cmp(base + i * width, base) < 0)
+                i++;
+            while (cmp(base + j * width, base) > 0)
+                j--;
+            if (i >= j)
+                break;
+            vector_sort_swap(base + i * width, base + j * width, width);
+            i++;
+            j--;
+        }
+        vector_sort_swap(base, base + j * width, width);
+
+        size_t left = j;
+        size_t right = count - j - 1;
+        if (left < right)
+        {
+            vector_introsort(base, left, width, cmp, depth);
+            base += (j + 1) * width;
+            count = right;
+        }
+        else
+        {
+            vector_introsort(base + (j + 1) * width, right, width, cmp,
+                             depth);
+            count = left;
+        }
+    }
+
+    vector_insertion_sort(base, count, width, cmp);
+}
+
+/*
+ * @brief Gets the introsort depth limit for a range
+ * @param count Number of elements
+ * @return 2 * floor(log2(count)) partitioning levels
+ */
+static size_t vector_sort_depth(size_t count)
+{
+    size_t depth = 0;
+    for (size_t n = count; n > 1; n >>= 1)
+    {
+        depth += 2;
+    }
+    return depth;
+}
+
+/*
+ * @brief Reads a key and maps it to an unsigned value with the same order
+ * @param element Element holding the key
+ * @param key_type Type of the key
+ * @return Order-preserving unsigned key
+ *
+ * @note Signed keys flip the sign bit; floats also flip every other bit
+ * when negative, so larger magnitudes sort first
+ */
+static inline uint64_t vector_radix_key(const unsigned char *element,
+                                        data_type_t key_type)
+{
+    uint32_t bits32 = 0;
+    uint64_t bits64 = 0;
+
+    if (key_type == DATA_TYPE_INT32 || key_type == DATA_TYPE_UINT32 ||
+        key_type == DATA_TYPE_FLOAT)
+    {
+#if defined(__GNUC__)
+        bits32 = *(const vector_u32_t *)element;
+#else
+        mem_copy(&bits32, element, sizeof(bits32));
+#endif
+    }
+    else
+    {
+#if defined(__GNUC__)
+        bits64 = *(const vector_u64_t *)element;
+#else
+        mem_copy(&bits64, element, sizeof(bits64));
+#endif
+    }
+
+    switch (key_type)
+    {
+    case DATA_TYPE_INT32:
+        return bits32 ^ UINT32_C(0x80000000);
+    case DATA_TYPE_UINT32:
+        return bits32;
+    case DATA_TYPE_FLOAT:
+        return (bits32 & UINT32_C(0x80000000)) ? (uint32_t)~bits32
+                                                : bits32 ^ UINT32_C(0x80000000);
+    case DATA_TYPE_INT64:
+        return bits64 ^ UINT64_C(0x8000000000000000);
+    case DATA_TYPE_UINT64:
+        return bits64;
+    case DATA_TYPE_DOUBLE:
+    default:
+        return (bits64 & UINT64_C(0x8000000000000000))
+                   ? ~bits64
+                   : bits64 ^ UINT64_C(0x8000000000000000);
+    }
+}
+
+#if CSTRUCTS_HAVE_PTHREADS
+
+/*
+ * @brief One thread's share of a parallel sort phase
+ */
+typedef struct
+{
+        unsigned char *src;   // Runs being read
+        unsigned char *dest;  // Merge output (unused while sorting slices)
+        const size_t *bounds; // Run boundaries, runs + 1 entries
+        size_t runs;          // Number of sorted runs in src
+        size_t width;         // Element size in bytes
+        cmp_fn cmp;           // Comparison function
+        size_t begin;         // First output position owned by this thread
+        size_t end;           // One past the last owned position
+} vector_sort_task_t;
+
+/*
+ * @brief Finds how many elements of a the first k merged outputs take
+ * @param a First sorted run
+ * @param a_count Length of a
+ * @param b Second sorted run
+ * @param b_count Length of b
+ * @param k Output position
+ * @param width Element size in bytes
+ * @param cmp Comparison function
+ * @return Elements of a among the first k outputs; k minus this come from b
+ *
+ * @note Time complexity: O(log min(k, a_count))
+ * @note Merge path: ties go to a, matching vector_merge_runs
+ */
+static size_t vector_merge_corank(const unsigned char *a, size_t a_count,
+                                  const unsigned char *b, size_t b_count,
+                                  size_t k, size_t width, cmp_fn cmp)
+{
+    size_t low = k > b_count ? k - b_count : 0;
+    size_t high = k < a_count ? k : a_count;
+
+    // Smallest i for which b[k - i - 1] sorts strictly before a[i]
+    while (low < high)
+    {
+        size_t i = low + (high - low) / 2;
+        size_t j = k - i;
+        if (j > 0 && cmp(b + (j - 1) * width, a + i * width) >= 0)
+        {
+            low = i + 1;
+        }
+        else
+        {
+            high = i;
+        }
+    }
+
+    return low;
+}
+
+/*
+ * @brief Merges two sorted ranges into an output buffer
+ * @param dest Output, room for a_count + b_count elements
+ * @param a First sorted range
+ * @param a_count Length of a
+ * @param b Second sorted range
+ * @param b_count Length of b
+ * @param width Element size in bytes
+ * @param cmp Comparison function
+ */
+static void vector_merge_runs(unsigned char *dest, const unsigned char *a,
+                              size_t a_count, const unsigned char *b,
+                              size_t b_count, size_t width, cmp_fn cmp)
+{
+    const unsigned char *a_end = a + a_count * width;
+    const unsigned char *b_end = b + b_count * width;
+
+    while (a < a_end && b < b_end)
+    {
+        if (cmp(b, a) < 0)
+        {
+            vector_sort_move(dest, b, width);
+            b += width;
+        }
+        else
+        {
+            vector_sort_move(dest, a, width);
+            a += width;
+        }
+        dest += width;
+    }
+
+    // One side is exhausted; the rest of the other is already in order
+    if (a < a_end)
+    {
+        mem_copy(dest, a, (size_t)(a_end - a));
+    }
+    if (b < b_end)
+    {
+        mem_copy(dest, b, (size_t)(b_end - b));
+    }
+}
+
+/*
+ * @brief Thread entry: introsorts the slice [begin, end) of src
+ * @param arg Pointer to a vector_sort_task_t
+ * @return NULL
+ */
+static void *vector_sort_slice_worker(void *arg)
+{
+    vector_sort_task_t *task = (vector_sort_task_t *)arg;
+    size_t count = task->end - task->begin;
+
+    vector_introsort(task->src + task->begin * task->width, count,
+                     task->width, task->cmp, vector_sort_depth(count));
+    return NULL;
+}
+
+/*
+ * @brief Thread entry: writes output positions [begin, end) of one round
+ * that merges runs 2q and 2q + 1 for every q
+ * @param arg Pointer to a vector_sort_task_t
+ * @return NULL
+ */
+static void *vector_sort_merge_worker(void *arg)
+{
+    vector_sort_task_t *task = (vector_sort_task_t *)arg;
+    size_t width = task->width;
+
+    for (size_t run = 0; run < task->runs; run += 2)
+    {
+        size_t low = task->bounds[run];
+        size_t middle = task->bounds[run + 1];
+        size_t high = run + 2 <= task->runs ? task->bounds[run + 2] : middle;
+
+        // Only the part of this pair's output that belongs to the thread
+        size_t first = task->begin > low ? task->begin : low;
+        size_t last = task->end < high ? task->end : high;
+        if (first >= last)
+        {
+            continue;
+        }
+
+        const unsigned char *a = task->src + low * width;
+        const unsigned char *b = task->src + middle * width;
+        size_t a_count = middle - low;
+        size_t b_count = high - middle;
+
+        size_t a_first = vector_merge_corank(a, a_count, b, b_count,
+                                             first - low, width, task->cmp);
+        size_t a_last = vector_merge_corank(a, a_count, b, b_count,
+                                            last - low, width, task->cmp);
+        size_t b_first = first - low - a_first;
+        size_t b_last = last - low - a_last;
+
+        vector_merge_runs(task->dest + first * width, a + a_first * width,
+                          a_last - a_first, b + b_first * width,
+                          b_last - b_first, width, task->cmp);
+    }
+
+    return NULL;
+}
+
+/*
+ * @brief Runs one task per thread and waits for all of them
+ * @param worker Thread entry point
+ * @param tasks Tasks to run
+ * @param threads Number of tasks
+ * @param handles Room for threads - 1 thread handles
+ * @param started Room for threads flags; started[t] records whether task t
+ * got its own thread
+ *
+ * @note The calling thread runs the first task itself; a task whose thread
+ * cannot be started also runs on the calling thread
+ */
+static void vector_sort_run(void *(*worker)(void *), vector_sort_task_t *tasks,
+                            size_t threads, pthread_t *handles, bool *started)
+{
+    for (size_t t = 1; t < threads; t++)
+    {
+        started[t] = pthread_create(&handles[t - 1], NULL, worker,
+                                    &tasks[t]) == 0;
+    }
+
+    worker(&tasks[0]);
+
+    for (size_t t = 1; t < threads; t++)
+    {
+        if (started[t])
+        {
+            pthread_join(handles[t - 1], NULL);
+        }
+        else
+        {
+            worker(&tasks[t]);
+        }
+    }
+}
+
+#endif /* CSTRUCTS_HAVE_PTHREADS */
+
+/* ===== SORTING ===== */
+
+status_t vector_sort(vector_t *vector, cmp_fn cmp)
+{
+    if (vector == NULL || cmp == NULL)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (vector->size < 2)
+    {
+        return SUCCESS;
+    }
+
+    vector_introsort((unsigned char *)vector->data, vector->size,
+                     vector->element_size, cmp,
+                     vector_sort_depth(vector->size));
+
+    return SUCCESS;
+}
+
+status_t vector_sort_radix(vector_t *vector, data_type_t key_type,
+                           size_t key_offset)
+{
+    if (vector == NULL)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    size_t key_size;
+    switch (key_type)
+    {
+    case DATA_TYPE_INT32:
+    case DATA_TYPE_UINT32:
+    case DATA_TYPE_FLOAT:
+        key_size = 4;
+        break;
+    case DATA_TYPE_INT64:
+    case DATA_TYPE_UINT64:
+    case DATA_TYPE_DOUBLE:
+        key_size = 8;
+        break;
+    default:
+        return ERROR_INVALID_INPUT;
+    }
+
+    size_t width = vector->element_size;
+    if (key_offset > width || key_size > width - key_offset)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    size_t count = vector->size;
+    if (count < 2)
+    {
+        return SUCCESS;
+    }
+
+    // Histogram every digit position in one read of the data
+    size_t histogram[8][VECTOR_RADIX_BUCKETS];
+    mem_set(histogram, 0, sizeof(histogram));
+
+    const unsigned char *data = (const unsigned char *)vector->data;
+    for (size_t i = 0; i < count; i++)
+    {
+        uint64_t key = vector_radix_key(data + i * width + key_offset,
+                                        key_type);
+        for (size_t pass = 0; pass < key_size; pass++)
+        {
+            histogram[pass][(key >> (pass * VECTOR_RADIX_BITS)) &
+                            (VECTOR_RADIX_BUCKETS - 1)]++;
+        }
+    }
+
+    // Same capacity as the vector so the buffers can trade places
+    unsigned char *scratch = (unsigned char *)allocator_alloc(
+        &vector->allocator, vector->capacity * width);
+    if (scratch == NULL)
+    {
+        return ERROR_MEMORY_ALLOCATION;
+    }
+
+    unsigned char *src = (unsigned char *)vector->data;
+    unsigned char *dest = scratch;
+
+    for (size_t pass = 0; pass < key_size; pass++)
+    {
+        size_t *counts = histogram[pass];
+        size_t shift = pass * VECTOR_RADIX_BITS;
+
+        // Every key has the same digit here: the pass would not move anything
+        size_t first = (vector_radix_key(src + key_offset, key_type) >>
+                        shift) & (VECTOR_RADIX_BUCKETS - 1);
+        if (counts[first] == count)
+        {
+            continue;
+        }
+
+        // Turn counts into starting offsets
+        size_t offset = 0;
+        for (size_t digit = 0; digit < VECTOR_RADIX_BUCKETS; digit++)
+        {
+            size_t bucket = counts[digit];
+            counts[digit] = offset;
+            offset += bucket;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            const unsigned char *element = src + i * width;
+            size_t digit =
+                (vector_radix_key(element + key_offset, key_type) >> shift) &
+                (VECTOR_RADIX_BUCKETS - 1);
+            vector_sort_move(dest + counts[digit]++ * width, element, width);
+        }
+
+        unsigned char *temp = src;
+        src = dest;
+        dest = temp;
+    }
+
+    // The sorted data may have ended in the scratch buffer; keep that one
+    vector->data = src;
+    allocator_free(&vector->allocator, dest, vector->capacity * width);
+
+    return SUCCESS;
+}
+
+status_t vector_sort_parallel(vector_t *vector, cmp_fn cmp, size_t nthreads)
+{
+    if (vector == NULL || cmp == NULL)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+#if CSTRUCTS_HAVE_PTHREADS
+    if (nthreads == 0)
+    {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        nthreads = online > 0 ? (size_t)online : 1;
+    }
+
+    // Every thread gets a slice large enough to repay starting it
+    size_t count = vector->size;
+    size_t width = vector->element_size;
+    if (nthreads > count / VECTOR_PARALLEL_MIN_CHUNK)
+    {
+        nthreads = count / VECTOR_PARALLEL_MIN_CHUNK;
+    }
+    if (nthreads < 2)
+    {
+        return vector_sort(vector, cmp);
+    }
+
+    // One block holds the tasks, run bounds, thread handles and start flags
+    size_t block_size = nthreads * sizeof(vector_sort_task_t) +
+                        (nthreads + 1) * sizeof(size_t) +
+                        nthreads * sizeof(pthread_t) + nthreads * sizeof(bool);
+    vector_sort_task_t *tasks =
+        (vector_sort_task_t *)allocator_alloc(&vector->allocator, block_size);
+    if (tasks == NULL)
+    {
+        return ERROR_MEMORY_ALLOCATION;
+    }
+    size_t *bounds = (size_t *)(tasks + nthreads);
+    pthread_t *handles = (pthread_t *)(bounds + nthreads + 1);
+    bool *started = (bool *)(handles + nthreads);
+
+    unsigned char *scratch = (unsigned char *)allocator_alloc(
+        &vector->allocator, vector->capacity * width);
+    if (scratch == NULL)
+    {
+        allocator_free(&vector->allocator, tasks, block_size);
+        return ERROR_MEMORY_ALLOCATION;
+    }
+
+    unsigned char *src = (unsigned char *)vector->data;
+    unsigned char *dest = scratch;
+
+    // Each thread owns an equal share of positions in every phase
+    for (size_t t = 0; t <= nthreads; t++)
+    {
+        bounds[t] = count / nthreads * t + (count % nthreads) * t / nthreads;
+    }
+    for (size_t t = 0; t < nthreads; t++)
+    {
+        tasks[t].width = width;
+        tasks[t].cmp = cmp;
+        tasks[t].begin = bounds[t];
+        tasks[t].end = bounds[t + 1];
+        tasks[t].src = src;
+    }
+
+    // Phase 1: sort one slice per thread, leaving nthreads runs
+    vector_sort_run(vector_sort_slice_worker, tasks, nthreads, handles,
+                    started);
+
+    // Phase 2: merge runs in pairs until one remains
+    size_t runs = nthreads;
+    while (runs > 1)
+    {
+        for (size_t t = 0; t < nthreads; t++)
+        {
+            tasks[t].src = src;
+            tasks[t].dest = dest;
+            tasks[t].bounds = bounds;
+            tasks[t].runs = runs;
+        }
+        vector_sort_run(vector_sort_merge_worker, tasks, nthreads, handles,
+                        started);
+
+        // Merged pairs keep every other boundary
+        size_t merged = 0;
+        for (size_t run = 0; run < runs; run += 2)
+        {
+            bounds[merged++] = bounds[run];
+        }
+        bounds[merged] = count;
+        runs = merged;
+
+        unsigned char *temp = src;
+        src = dest;
+        dest = temp;
+    }
+
+    // The sorted data may have ended in the scratch buffer; keep that one
+    vector->data = src;
+    allocator_free(&vector->allocator, dest, vector->capacity * width);
+    allocator_free(&vector->allocator, tasks, block_size);
+
+    return SUCCESS;
+#else
+    (void)nthreads;
+    return vector_sort(vector, cmp);
+#endif
+}
+
+/* ===== SORTED VECTOR HELPERS ===== */
+
+/*
+ * @brief Checks whether an element sorts before a bound
+ * @param element Element to test
+ * @param key Bound
+ * @param cmp Comparison function
+ * @param upper When true, elements equal to key also count as before it
+ * @return true if element belongs before the bound
+ */
+static inline bool vector_before(const unsigned char *element,
+                                 const void *key, cmp_fn cmp, bool upper)
+{
+    int order = cmp(element, key);
+    return upper ? order <= 0 : order < 0;
+}
+
+/*
+ * @brief Binary search over [first, last) for the end of the elements that
+ * sort before a bound
+ * @param base First element of the array
+ * @param first Start of the searched range
+ * @param last End of the searched range
+ * @param width Element size in bytes
+ * @param key Bound
+ * @param cmp Comparison function
+ * @param upper Whether elements equal to key count as before it
+ * @return First index in [first, last) not before the bound, or last
+ *
+ * @note Time complexity: O(log(last - first))
+ */
+static size_t vector_bound(const unsigned char *base, size_t first,
+                           size_t last, size_t width, const void *key,
+                           cmp_fn cmp, bool upper)
+{
+    size_t count = last - first;
+
+    while (count > 0)
+    {
+        size_t half = count / 2;
+        if (vector_before(base + (first + half) * width, key, cmp, upper))
+        {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else
+        {
+            count = half;
+        }
+    }
+
+    return first;
+}
+
+/*
+ * @brief Exponential search from first, then binary search, for the end of
+ * the elements that sort before a bound
+ * @param base First element of the array
+ * @param first Start of the searched range
+ * @param last End of the searched range
+ * @param width Element size in bytes
+ * @param key Bound
+ * @param cmp Comparison function
+ * @param upper Whether elements equal to key count as before it
+ * @return First index in [first, last) not before the bound, or last
+ *
+ * @note Time complexity: O(log k) where k is the distance to the result;
+ * one comparison when the bound is at first
+ */
+static size_t vector_gallop(const unsigned char *base, size_t first,
+                            size_t last, size_t width, const void *key,
+                            cmp_fn cmp, bool upper)
+{
+    if (first >= last ||
+        !vector_before(base + first * width, key, cmp, upper))
+    {
+        return first;
+    }
+
+    // Probe first + 1, + 2, + 4, ... until one is past the bound
+    size_t low = first + 1;
+    size_t offset = 1;
+    while (offset < last - first &&
+           vector_before(base + (first + offset) * width, key, cmp, upper))
+    {
+        low = first + offset + 1;
+        offset <<= 1;
+    }
+
+    size_t high = offset < last - first ? first + offset : last;
+    return vector_bound(base, low, high, width, key, cmp, upper);
+}
+
+/*
+ * @brief Validates a set operation and sizes its output
+ * @param dest Output vector
+ * @param a First input
+ * @param b Second input
+ * @param cmp Comparison function
+ * @param capacity Largest possible output size
+ * @return SUCCESS if the operation may proceed, error code otherwise
+ *
+ * @note Empties dest on success; on failure dest is left unchanged
+ */
+static status_t vector_set_prepare(vector_t *dest, const vector_t *a,
+                                   const vector_t *b, cmp_fn cmp,
+                                   size_t capacity)
+{
+    if (dest == NULL || a == NULL || b == NULL || cmp == NULL ||
+        dest == a || dest == b)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (a->element_size != dest->element_size ||
+        b->element_size != dest->element_size)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    // Reserve before clearing so a failed call leaves dest untouched
+    status_t result = vector_reserve(dest, capacity);
+    if (result == SUCCESS)
+    {
+        dest->size = 0;
+    }
+    return result;
+}
+
+/*
+ * @brief Appends a run of elements without a capacity check
+ * @param dest Output vector, already reserved
+ * @param src First element of the run
+ * @param count Number of elements
+ */
+static inline void vector_set_emit(vector_t *dest, const unsigned char *src,
+                                   size_t count)
+{
+    if (count > 0)
+    {
+        mem_copy((unsigned char *)dest->data + dest->size * dest->element_size,
+                 src, count * dest->element_size);
+        dest->size += count;
+    }
+}
+
+/* ===== SORTED VECTOR OPERATIONS ===== */
+
+size_t vector_lower_bound(const vector_t *vector, const void *key,
+                          cmp_fn cmp)
+{
+    if (vector == NULL || key == NULL || cmp == NULL)
+    {
+        return 0;
+    }
+
+    return vector_bound((const unsigned char *)vector->data, 0, vector->size,
+                        vector->element_size, key, cmp, false);
+}
+
+size_t vector_upper_bound(const vector_t *vector, const void *key,
+                          cmp_fn cmp)
+{
+    if (vector == NULL || key == NULL || cmp == NULL)
+    {
+        return 0;
+    }
+
+    return vector_bound((const unsigned char *)vector->data, 0, vector->size,
+                        vector->element_size, key, cmp, true);
+}
+
+int vector_binary_search(const vector_t *vector, const void *key, cmp_fn cmp)
+{
+    if (vector == NULL || key == NULL || cmp == NULL)
+    {
+        return -1;
+    }
+
+    size_t index = vector_lower_bound(vector, key, cmp);
+    if (index < vector->size &&
+        cmp((const char *)vector->data + index * vector->element_size,
+            key) == 0)
+    {
+        return (int)index;
+    }
+
+    return -1;
+}
+
+status_t vector_merge(vector_t *dest, const vector_t *a, const vector_t *b,
+                      cmp_fn cmp)
+{
+    if (a == NULL || b == NULL)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    status_t result =
+        vector_set_prepare(dest, a, b, cmp, a->size + b->size);
+    if (result != SUCCESS)
+    {
+        return result;
+    }
+
+    const unsigned char *a_data = (const unsigned char *)a->data;
+    const unsigned char *b_data = (const unsigned char *)b->data;
+    size_t width = dest->element_size;
+    size_t i = 0;
+    size_t j = 0;
+
+    while (i < a->size && j < b->size)
+    {
+        // Run of a up to and including elements equal to b[j]
+        size_t end = vector_gallop(a_data, i, a->size, width,
+                                   b_data + j * width, cmp, true);
+        vector_set_emit(dest, a_data + i * width, end - i);
+        i = end;
+        if (i == a->size)
+        {
+            break;
+        }
+
+        // Run of b strictly before a[i]
+        end = vector_gallop(b_data, j, b->size, width, a_data + i * width,
+                            cmp, false);
+        vector_set_emit(dest, b_data + j * width, end - j);
+        j = end;
+    }
+
+    vector_set_emit(dest, a_data + i * width, a->size - i);
+    vector_set_emit(dest, b_data + j * width, b->size - j);
+
+    return SUCCESS;
+}
+
+status_t vector_set_union(vector_t *dest, const vector_t *a,
+                          const vector_t *b, cmp_fn cmp)
+{
+    if (a == NULL || b == NULL)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    status_t result =
+        vector_set_prepare(dest, a, b, cmp, a->size + b->size);
+    if (result != SUCCESS)
+    {
+        return result;
+    }
+
+    const unsigned char *a_data = (const unsigned char *)a->data;
+    const unsigned char *b_data = (const unsigned char *)b->data;
+    size_t width = dest->element_size;
+    size_t i = 0;
+    size_t j = 0;
+
+    while (i < a->size && j < b->size)
+    {
+        size_t end = vector_gallop(a_data, i, a->size, width,
+                                   b_data + j * width, cmp, false);
+        vector_set_emit(dest, a_data + i * width, end - i);
+        i = end;
+        if (i == a->size)
+        {
+            break;
+        }
+
+        end = vector_gallop(b_data, j, b->size, width, a_data + i * width,
+                            cmp, false);
+        vector_set_emit(dest, b_data + j * width, end - j);
+        j = end;
+        if (j == b->size)
+        {
+            break;
+        }
+
+        // Neither sorts before the other: a match is taken once
+        if (cmp(a_data + i * width, b_data + j * width) == 0)
+        {
+            vector_set_emit(dest, a_data + i * width, 1);
+            i++;
+            j++;
+        }
+    }
+
+    vector_set_emit(dest, a_data + i * width, a->size - i);
+    vector_set_emit(dest, b_data + j * width, b->size - j);
+
+    return SUCCESS;
+}
+
+status_t vector_set_intersection(vector_t *dest, const vector_t *a,
+                                 const vector_t *b, cmp_fn cmp)
+{
+    if (a == NULL || b == NULL)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    status_t result = vector_set_prepare(
+        dest, a, b, cmp, a->size < b->size ? a->size : b->size);
+    if (result != SUCCESS)
+    {
+        return result;
+    }
+
+    const unsigned char *a_data = (const unsigned char *)a->data;
+    const unsigned char *b_data = (const unsigned char *)b->data;
+    size_t width = dest->element_size;
+    size_t i = 0;
+    size_t j = 0;
+
+    // Each side skips ahead to the other's current element
+    while (i < a->size && j < b->size)
+    {
+        i = vector_gallop(a_data, i, a->size, width, b_data + j * width, cmp,
+                          false);
+        if (i == a->size)
+        {
+            break;
+        }
+
+        j = vector_gallop(b_data, j, b->size, width, a_data + i * width, cmp,
+                          false);
+        if (j == b->size)
+        {
+            break;
+        }
+
+        if (cmp(a_data + i * width, b_data + j * width) == 0)
+        {
+            vector_set_emit(dest, a_data + i * width, 1);
+            i++;
+            j++;
+        }
+    }
+
+    return SUCCESS;
+}
+
+status_t vector_set_difference(vector_t *dest, const vector_t *a,
+                               const vector_t *b, cmp_fn cmp)
+{
+    if (a == NULL)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    status_t result = vector_set_prepare(dest, a, b, cmp, a->size);
+    if (result != SUCCESS)
+    {
+        return result;
+    }
+
+    const unsigned char *a_data = (const unsigned char *)a->data;
+    const unsigned char *b_data = (const unsigned char *)b->data;
+    size_t width = dest->element_size;
+    size_t i = 0;
+    size_t j = 0;
+
+    while (i < a->size && j < b->size)
+    {
+        size_t end = vector_gallop(a_data, i, a->size, width,
+                                   b_data + j * width, cmp, false);
+        vector_set_emit(dest, a_data + i * width, end - i);
+        i = end;
+        if (i == a->size)
+        {
+            break;
+        }
+
+        j = vector_gallop(b_data, j, b->size, width, a_data + i * width, cmp,
+                          false);
+        if (j == b->size)
+        {
+            break;
+        }
+
+        // A match removes one copy from the output
+        if (cmp(a_data + i * width, b_data + j * width) == 0)
+        {
+            i++;
+            j++;
+        }
+    }
+
+    vector_set_emit(dest, a_data + i * width, a->size - i);
+
+    return SUCCESS;
+}
+
+/* ===== NUMERIC KERNELS ===== */
+
+/*
+ * Kernels take a raw element array and its length. Scans return the index
+ * of the first match (count when there is none) or the number of matches;
+ * reductions store their result in the data_t member of the element's
+ * width. min and max require count > 0.
+ */
+typedef size_t (*vector_scan_kernel_t)(const void *data, size_t count,
+                                       const data_t *value);
+typedef void (*vector_reduce_kernel_t)(const void *data, size_t count,
+                                       data_t *result);
+
+typedef struct
+{
+        vector_scan_kernel_t find_eq;  // First index equal to value
+        vector_scan_kernel_t count_eq; // Number of elements equal to value
+        vector_reduce_kernel_t min;    // Smallest element
+        vector_reduce_kernel_t max;    // Largest element
+        vector_reduce_kernel_t sum;    // Sum, widened (see vector_sum)
+        size_t element_size;           // Width of the numeric type
+} vector_numeric_kernels_t;
+
+/*
+ * @brief Defines the portable kernels for one numeric type
+ * @param suffix Name suffix of the generated kernels
+ * @param T Element type
+ * @param member data_t member holding a T
+ * @param ACC_T Accumulator type of the sum
+ * @param sum_member data_t member receiving the sum
+ *
+ * @note Integer sums accumulate in uint64_t, so they wrap instead of
+ * overflowing
+ */
+#define VECTOR_SCALAR_KERNELS(suffix, T, member, ACC_T, sum_member)           \
+    static size_t vector_find_eq_##suffix(const void *data, size_t count,     \
+                                          const data_t *value)                \
+    {                                                                         \
+        const T *values = (const T *)data;                                    \
+        const T key = (T)value->member;                                       \
+        for (size_t i = 0; i < count; i++)                                    \
+        {                                                                     \
+            if (values[i] == key)                                             \
+            {                                                                 \
+                return i;                                                     \
+            }                                                                 \
+        }                                                                     \
+        return count;                                                         \
+    }                                                                         \
+                                                                              \
+    static size_t vector_count_eq_##suffix(const void *data, size_t count,    \
+                                           const data_t *value)               \
+    {                                                                         \
+        const T *values = (const T *)data;                                    \
+        const T key = (T)value->member;                                       \
+        size_t total = 0;                                                     \
+        for (size_t i = 0; i < count; i++)                                    \
+        {                                                                     \
+            total += values[i] == key;                                        \
+        }                                                                     \
+        return total;                                                         \
+    }                                                                         \
+                                                                              \
+    static void vector_min_##suffix(const void *data, size_t count,           \
+                                    data_t *result)                           \
+    {                                                                         \
+        const T *values = (const T *)data;                                    \
+        T best = values[0];                                                   \
+        for (size_t i = 1; i < count; i++)                                    \
+        {                                                                     \
+            best = values[i] < best ? values[i] : best;                       \
+        }                                                                     \
+        result->member = best;                                                \
+    }                                                                         \
+                                                                              \
+    static void vector_max_##suffix(const void *data, size_t count,           \
+                                    data_t *result)                           \
+    {                                                                         \
+        const T *values = (const T *)data;                                    \
+        T best = values[0];                                                   \
+        for (size_t i = 1; i < count; i++)                                    \
+        {                                                                     \
+            best = values[i] > best ? values[i] : best;                       \
+        }                                                                     \
+        result->member = best;                                                \
+    }                                                                         \
+                                                                              \
+    static void vector_sum_##suffix(const void *data, size_t count,           \
+                                    data_t *result)                           \
+    {                                                                         \
+        const T *values = (const T *)data;                                    \
+        ACC_T total = 0;                                                      \
+        for (size_t i = 0; i < count; i++)                                    \
+        {                                                                     \
+            total += (ACC_T)values[i];                                        \
+        }                                                                     \
+        result->sum_member = total;                                           \
+    }
+
+VECTOR_SCALAR_KERNELS(i32, int32_t, int_value, uint64_t, long_value)
+VECTOR_SCALAR_KERNELS(u32, uint32_t, int_value, uint64_t, long_value)
+VECTOR_SCALAR_KERNELS(i64, int64_t, long_value, uint64_t, long_value)
+VECTOR_SCALAR_KERNELS(u64, uint64_t, long_value, uint64_t, long_value)
+VECTOR_SCALAR_KERNELS(f32, float, float_value, double, double_value)
+VECTOR_SCALAR_KERNELS(f64, double, double_value, double, double_value)
+
+#undef VECTOR_SCALAR_KERNELS
+
+static const vector_numeric_kernels_t vector_numeric_scalar[] = {
+    [DATA_TYPE_INT32] = {vector_find_eq_i32, vector_count_eq_i32,
+                         vector_min_i32, vector_max_i32, vector_sum_i32,
+                         sizeof(int32_t)},
+    [DATA_TYPE_UINT32] = {vector_find_eq_u32, vector_count_eq_u32,
+                          vector_min_u32, vector_max_u32, vector_sum_u32,
+                          sizeof(uint32_t)},
+    [DATA_TYPE_INT64] = {vector_find_eq_i64, vector_count_eq_i64,
+                         vector_min_i64, vector_max_i64, vector_sum_i64,
+                         sizeof(int64_t)},
+    [DATA_TYPE_UINT64] = {vector_find_eq_u64, vector_count_eq_u64,
+                          vector_min_u64, vector_max_u64, vector_sum_u64,
+                          sizeof(uint64_t)},
+    [DATA_TYPE_FLOAT] = {vector_find_eq_f32, vector_count_eq_f32,
+                         vector_min_f32, vector_max_f32, vector_sum_f32,
+                         sizeof(float)},
+    [DATA_TYPE_DOUBLE] = {vector_find_eq_f64, vector_count_eq_f64,
+                          vector_min_f64, vector_max_f64, vector_sum_f64,
+                          sizeof(double)},
+};
+
+#if CSTRUCTS_HAVE_X86_SIMD
+
+/*
+ * @brief Adds the eight 32-bit lanes of a vector as unsigned counts
+ */
+__attribute__((target("avx2"))) static uint64_t
+vector_lanes_u32_avx2(__m256i lanes)
+{
+    uint32_t parts[8];
+    _mm256_storeu_si256((__m256i *)parts, lanes);
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < 8; i++)
+    {
+        total += parts[i];
+    }
+    return total;
+}
+
+/*
+ * @brief Adds the four 64-bit lanes of a vector, wrapping
+ */
+__attribute__((target("avx2"))) static uint64_t
+vector_lanes_u64_avx2(__m256i lanes)
+{
+    uint64_t parts[4];
+    _mm256_storeu_si256((__m256i *)parts, lanes);
+    return parts[0] + parts[1] + parts[2] + parts[3];
+}
+
+/*
+ * @brief Adds the four double lanes of a vector
+ */
+__attribute__((target("avx2"))) static double
+vector_lanes_f64_avx2(__m256d lanes)
+{
+    double parts[4];
+    _mm256_storeu_pd(parts, lanes);
+    return (parts[0] + parts[1]) + (parts[2] + parts[3]);
+}
+
+/* int32: 8 lanes */
+
+__attribute__((target("avx2"))) static size_t
+vector_find_eq_i32_avx2(const void *data, size_t count, const data_t *value)
+{
+    const int32_t *values = (const int32_t *)data;
+    const __m256i key = _mm256_set1_epi32(value->int_value);
+    size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(values + i));
+        unsigned mask = (unsigned)_mm256_movemask_ps(
+            _mm256_castsi256_ps(_mm256_cmpeq_epi32(v, key)));
+        if (mask != 0)
+        {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+    }
+
+    return i + vector_find_eq_i32(values + i, count - i, value);
+}
+
+__attribute__((target("avx2"))) static size_t
+vector_count_eq_i32_avx2(const void *data, size_t count, const data_t *value)
+{
+    const int32_t *values = (const int32_t *)data;
+    const __m256i key = _mm256_set1_epi32(value->int_value);
+    size_t total = 0;
+    size_t i = 0;
+
+    while (count - i >= 8)
+    {
+        size_t vectors = (count - i) / 8;
+        if (vectors > VECTOR_COUNT_FLUSH)
+        {
+            vectors = VECTOR_COUNT_FLUSH;
+        }
+
+        // A match compares as -1, so subtracting counts it
+        __m256i hits = _mm256_setzero_si256();
+        for (size_t n = 0; n < vectors; n++, i += 8)
+        {
+            __m256i v = _mm256_loadu_si256((const __m256i *)(values + i));
+            hits = _mm256_sub_epi32(hits, _mm256_cmpeq_epi32(v, key));
+        }
+        total += (size_t)vector_lanes_u32_avx2(hits);
+    }
+
+    return total + vector_count_eq_i32(values + i, count - i, value);
+}
+
+/*
+ * @note min and max finish with a vector that may overlap the previous one,
+ * which is harmless because both are idempotent
+ */
+__attribute__((target("avx2"))) static void
+vector_min_i32_avx2(const void *data, size_t count, data_t *result)
+{
+    const int32_t *values = (const int32_t *)data;
+    if (count < 8)
+    {
+        vector_min_i32(data, count, result);
+        return;
+    }
+
+    __m256i best = _mm256_loadu_si256((const __m256i *)values);
+    for (size_t i = 8; i < count; i += 8)
+    {
+        size_t at = i + 8 <= count ? i : count - 8;
+        best = _mm256_min_epi32(
+            best, _mm256_loadu_si256((const __m256i *)(values + at)));
+    }
+
+    int32_t lanes[8];
+    _mm256_storeu_si256((__m256i *)lanes, best);
+    vector_min_i32(lanes, 8, result);
+}
+
+__attribute__((target("avx2"))) static void
+vector_max_i32_avx2(const void *data, size_t count, data_t *result)
+{
+    const int32_t *values = (const int32_t *)data;
+    if (count < 8)
+    {
+        vector_max_i32(data, count, result);
+        return;
+    }
+
+    __m256i best = _mm256_loadu_si256((const __m256i *)values);
+    for (size_t i = 8; i < count; i += 8)
+    {
+        size_t at = i + 8 <= count ? i : count - 8;
+        best = _mm256_max_epi32(
+            best, _mm256_loadu_si256((const __m256i *)(values + at)));
+    }
+
+    int32_t lanes[8];
+    _mm256_storeu_si256((__m256i *)lanes, best);
+    vector_max_i32(lanes, 8, result);
+}
+
+__attribute__((target("avx2"))) static void
+vector_sum_i32_avx2(const void *data, size_t count, data_t *result)
+{
+    const int32_t *values = (const int32_t *)data;
+    __m256i low = _mm256_setzero_si256();
+    __m256i high = _mm256_setzero_si256();
+    size_t i = 0;
+
+    // Sign-extend each half to 64-bit lanes
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(values + i));
+        low = _mm256_add_epi64(
+            low, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        high = _mm256_add_epi64(
+            high, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+
+    vector_sum_i32(values + i, count - i, result);
+    result->long_value = (int64_t)((uint64_t)result->long_value +
+                                   vector_lanes_u64_avx2(
+                                       _mm256_add_epi64(low, high)));
+}
+
+/* int64: 4 lanes */
+
+__attribute__((target("avx2"))) static size_t
+vector_find_eq_i64_avx2(const void *data, size_t count, const data_t *value)
+{
+    const int64_t *values = (const int64_t *)data;
+    const __m256i key = _mm256_set1_epi64x(value->long_value);
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(values + i));
+        unsigned mask = (unsigned)_mm256_movemask_pd(
+            _mm256_castsi256_pd(_mm256_cmpeq_epi64(v, key)));
+        if (mask != 0)
+        {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+    }
+
+    return i + vector_find_eq_i64(values + i, count - i, value);
+}
+
+__attribute__((target("avx2"))) static size_t
+vector_count_eq_i64_avx2(const void *data, size_t count, const data_t *value)
+{
+    const int64_t *values = (const int64_t *)data;
+    const __m256i key = _mm256_set1_epi64x(value->long_value);
+    __m256i hits = _mm256_setzero_si256();
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(values + i));
+        hits = _mm256_sub_epi64(hits, _mm256_cmpeq_epi64(v, key));
+    }
+
+    return (size_t)vector_lanes_u64_avx2(hits) +
+           vector_count_eq_i64(values + i, count - i, value);
+}
+
+/*
+ * @note AVX2 has no 64-bit min/max; compare and blend instead
+ */
+__attribute__((target("avx2"))) static void
+vector_min_i64_avx2(const void *data, size_t count, data_t *result)
+{
+    const int64_t *values = (const int64_t *)data;
+    if (count < 4)
+    {
+        vector_min_i64(data, count, result);
+        return;
+    }
+
+    __m256i best = _mm256_loadu_si256((const __m256i *)values);
+    for (size_t i = 4; i < count; i += 4)
+    {
+        size_t at = i + 4 <= count ? i : count - 4;
+        __m256i v = _mm256_loadu_si256((const __m256i *)(values + at));
+        best = _mm256_blendv_epi8(best, v, _mm256_cmpgt_epi64(best, v));
+    }
+
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, best);
+    vector_min_i64(lanes, 4, result);
+}
+
+__attribute__((target("avx2"))) static void
+vector_max_i64_avx2(const void *data, size_t count, data_t *result)
+{
+    const int64_t *values = (const int64_t *)data;
+    if (count < 4)
+    {
+        vector_max_i64(data, count, result);
+        return;
+    }
+
+    __m256i best = _mm256_loadu_si256((const __m256i *)values);
+    for (size_t i = 4; i < count; i += 4)
+    {
+        size_t at = i + 4 <= count ? i : count - 4;
+        __m256i v = _mm256_loadu_si256((const __m256i *)(values + at));
+        best = _mm256_blendv_epi8(best, v, _mm256_cmpgt_epi64(v, best));
+    }
+
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, best);
+    vector_max_i64(lanes, 4, result);
+}
+
+__attribute__((target("avx2"))) static void
+vector_sum_i64_avx2(const void *data, size_t count, data_t *result)
+{
+    const int64_t *values = (const int64_t *)data;
+    __m256i total = _mm256_setzero_si256();
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        total = _mm256_add_epi64(
+            total, _mm256_loadu_si256((const __m256i *)(values + i)));
+    }
+
+    vector_sum_i64(values + i, count - i, result);
+    result->long_value = (int64_t)((uint64_t)result->long_value +
+                                   vector_lanes_u64_avx2(total));
+}
+
+/* float: 8 lanes */
+
+__attribute__((target("avx2"))) static size_t
+vector_find_eq_f32_avx2(const void *data, size_t count, const data_t *value)
+{
+    const float *values = (const float *)data;
+    const __m256 key = _mm256_set1_ps(value->float_value);
+    size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 v = _mm256_loadu_ps(values + i);
+        unsigned mask = (unsigned)_mm256_movemask_ps(
+            _mm256_cmp_ps(v, key, _CMP_EQ_OQ));
+        if (mask != 0)
+        {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+    }
+
+    return i + vector_find_eq_f32(values + i, count - i, value);
+}
+
+__attribute__((target("avx2"))) static size_t
+vector_count_eq_f32_avx2(const void *data, size_t count, const data_t *value)
+{
+    const float *values = (const float *)data;
+    const __m256 key = _mm256_set1_ps(value->float_value);
+    size_t total = 0;
+    size_t i = 0;
+
+    while (count - i >= 8)
+    {
+        size_t vectors = (count - i) / 8;
+        if (vectors > VECTOR_COUNT_FLUSH)
+        {
+            vectors = VECTOR_COUNT_FLUSH;
+        }
+
+        __m256i hits = _mm256_setzero_si256();
+        for (size_t n = 0; n < vectors; n++, i += 8)
+        {
+            __m256 v = _mm256_loadu_ps(values + i);
+            hits = _mm256_sub_epi32(
+                hits, _mm256_castps_si256(_mm256_cmp_ps(v, key, _CMP_EQ_OQ)));
+        }
+        total += (size_t)vector_lanes_u32_avx2(hits);
+    }
+
+    return total + vector_count_eq_f32(values + i, count - i, value);
+}
+
+__attribute__((target("avx2"))) static void
+vector_min_f32_avx2(const void *data, size_t count, data_t *result)
+{
+    const float *values = (const float *)data;
+    if (count < 8)
+    {
+        vector_min_f32(data, count, result);
+        return;
+    }
+
+    __m256 best = _mm256_loadu_ps(values);
+    for (size_t i = 8; i < count; i += 8)
+    {
+        size_t at = i + 8 <= count ? i : count - 8;
+        best = _mm256_min_ps(_mm256_loadu_ps(values + at), best);
+    }
+
+    float lanes[8];
+    _mm256_storeu_ps(lanes, best);
+    vector_min_f32(lanes, 8, result);
+}
+
+__attribute__((target("avx2"))) static void
+vector_max_f32_avx2(const void *data, size_t count, data_t *result)
+{
+    const float *values = (const float *)data;
+    if (count < 8)
+    {
+        vector_max_f32(data, count, result);
+        return;
+    }
+
+    __m256 best = _mm256_loadu_ps(values);
+    for (size_t i = 8; i < count; i += 8)
+    {
+        size_t at = i + 8 <= count ? i : count - 8;
+        best = _mm256_max_ps(_mm256_loadu_ps(values + at), best);
+    }
+
+    float lanes[8];
+    _mm256_storeu_ps(lanes, best);
+    vector_max_f32(lanes, 8, result);
+}
+
+__attribute__((target("avx2"))) static void
+vector_sum_f32_avx2(const void *data, size_t count, data_t *result)
+{
+    const float *values = (const float *)data;
+    __m256d low = _mm256_setzero_pd();
+    __m256d high = _mm256_setzero_pd();
+    size_t i = 0;
+
+    // Widen each half to double, matching the scalar accumulator
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 v = _mm256_loadu_ps(values + i);
+        low = _mm256_add_pd(low, _mm256_cvtps_pd(_mm256_castps256_ps128(v)));
+        high = _mm256_add_pd(high,
+                             _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+    }
+
+    vector_sum_f32(values + i, count - i, result);
+    result->double_value += vector_lanes_f64_avx2(_mm256_add_pd(low, high));
+}
+
+/* double: 4 lanes */
+
+__attribute__((target("avx2"))) static size_t
+vector_find_eq_f64_avx2(const void *data, size_t count, const data_t *value)
+{
+    const double *values = (const double *)data;
+    const __m256d key = _mm256_set1_pd(value->double_value);
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m256d v = _mm256_loadu_pd(values + i);
+        unsigned mask = (unsigned)_mm256_movemask_pd(
+            _mm256_cmp_pd(v, key, _CMP_EQ_OQ));
+        if (mask != 0)
+        {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+    }
+
+    return i + vector_find_eq_f64(values + i, count - i, value);
+}
+
+__attribute__((target("avx2"))) static size_t
+vector_count_eq_f64_avx2(const void *data, size_t count, const data_t *value)
+{
+    const double *values = (const double *)data;
+    const __m256d key = _mm256_set1_pd(value->double_value);
+    __m256i hits = _mm256_setzero_si256();
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m256d v = _mm256_loadu_pd(values + i);
+        hits = _mm256_sub_epi64(
+            hits, _mm256_castpd_si256(_mm256_cmp_pd(v, key, _CMP_EQ_OQ)));
+    }
+
+    return (size_t)vector_lanes_u64_avx2(hits) +
+           vector_count_eq_f64(values + i, count - i, value);
+}
+
+__attribute__((target("avx2"))) static void
+vector_min_f64_avx2(const void *data, size_t count, data_t *result)
+{
+    const double *values = (const double *)data;
+    if (count < 4)
+    {
+        vector_min_f64(data, count, result);
+        return;
+    }
+
+    __m256d best = _mm256_loadu_pd(values);
+    for (size_t i = 4; i < count; i += 4)
+    {
+        size_t at = i + 4 <= count ? i : count - 4;
+        best = _mm256_min_pd(_mm256_loadu_pd(values + at), best);
+    }
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, best);
+    vector_min_f64(lanes, 4, result);
+}
+
+__attribute__((target("avx2"))) static void
+vector_max_f64_avx2(const void *data, size_t count, data_t *result)
+{
+    const double *values = (const double *)data;
+    if (count < 4)
+    {
+        vector_max_f64(data, count, result);
+        return;
+    }
+
+    __m256d best = _mm256_loadu_pd(values);
+    for (size_t i = 4; i < count; i += 4)
+    {
+        size_t at = i + 4 <= count ? i : count - 4;
+        best = _mm256_max_pd(_mm256_loadu_pd(values + at), best);
+    }
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, best);
+    vector_max_f64(lanes, 4, result);
+}
+
+__attribute__((target("avx2"))) static void
+vector_sum_f64_avx2(const void *data, size_t count, data_t *result)
+{
+    const double *values = (const double *)data;
+    __m256d low = _mm256_setzero_pd();
+    __m256d high = _mm256_setzero_pd();
+    size_t i = 0;
+
+    // Two accumulators hide the latency of the dependent adds
+    for (; i + 8 <= count; i += 8)
+    {
+        low = _mm256_add_pd(low, _mm256_loadu_pd(values + i));
+        high = _mm256_add_pd(high, _mm256_loadu_pd(values + i + 4));
+    }
+
+    vector_sum_f64(values + i, count - i, result);
+    result->double_value += vector_lanes_f64_avx2(_mm256_add_pd(low, high));
+}
+
+/*
+ * @note Unsigned types share the equality scans (equality is bitwise);
+ * their ordering and widening differ, so they keep the portable kernels
+ */
+static const vector_numeric_kernels_t vector_numeric_avx2[] = {
+    [DATA_TYPE_INT32] = {vector_find_eq_i32_avx2, vector_count_eq_i32_avx2,
+                         vector_min_i32_avx2, vector_max_i32_avx2,
+                         vector_sum_i32_avx2, sizeof(int32_t)},
+    [DATA_TYPE_UINT32] = {vector_find_eq_i32_avx2, vector_count_eq_i32_avx2,
+                          vector_min_u32, vector_max_u32, vector_sum_u32,
+                          sizeof(uint32_t)},
+    [DATA_TYPE_INT64] = {vector_find_eq_i64_avx2, vector_count_eq_i64_avx2,
+                         vector_min_i64_avx2, vector_max_i64_avx2,
+                         vector_sum_i64_avx2, sizeof(int64_t)},
+    [DATA_TYPE_UINT64] = {vector_find_eq_i64_avx2, vector_count_eq_i64_avx2,
+                          vector_min_u64, vector_max_u64, vector_sum_u64,
+                          sizeof(uint64_t)},
+    [DATA_TYPE_FLOAT] = {vector_find_eq_f32_avx2, vector_count_eq_f32_avx2,
+                         vector_min_f32_avx2, vector_max_f32_avx2,
+                         vector_sum_f32_avx2, sizeof(float)},
+    [DATA_TYPE_DOUBLE] = {vector_find_eq_f64_avx2, vector_count_eq_f64_avx2,
+                          vector_min_f64_avx2, vector_max_f64_avx2,
+                          vector_sum_f64_avx2, sizeof(double)},
+};
+
+#endif /* CSTRUCTS_HAVE_X86_SIMD */
+
+/*
+ * @brief Picks the kernels for a numeric type on the running CPU
+ * @param vector Vector to scan
+ * @param type Element type
+ * @return Kernel table entry, NULL if the type is unknown or does not match
+ * the vector's element size
+ *
+ * @note AVX-512 machines use the AVX2 kernels; on SSE2-only machines the
+ * portable kernels run, which compilers vectorize where they can
+ */
+static const vector_numeric_kernels_t *
+vector_numeric_select(const vector_t *vector, data_type_t type)
+{
+    if (vector == NULL || type < DATA_TYPE_INT32 || type > DATA_TYPE_DOUBLE)
+    {
+        return NULL;
+    }
+
+    const vector_numeric_kernels_t *kernels = &vector_numeric_scalar[type];
+#if CSTRUCTS_HAVE_X86_SIMD
+    if (cpu_isa_level() >= CPU_ISA_AVX2)
+    {
+        kernels = &vector_numeric_avx2[type];
+    }
+#endif
+
+    return vector->element_size == kernels->element_size ? kernels : NULL;
+}
+
+/*
+ * @brief Checks whether a orders before b as values of a numeric type
+ */
+static bool vector_numeric_before(data_type_t type, const data_t *a,
+                                  const data_t *b)
+{
+    switch (type)
+    {
+    case DATA_TYPE_INT32:
+        return a->int_value < b->int_value;
+    case DATA_TYPE_UINT32:
+        return (uint32_t)a->int_value < (uint32_t)b->int_value;
+    case DATA_TYPE_INT64:
+        return a->long_value < b->long_value;
+    case DATA_TYPE_UINT64:
+        return (uint64_t)a->long_value < (uint64_t)b->long_value;
+    case DATA_TYPE_FLOAT:
+        return a->float_value < b->float_value;
+    default:
+        return a->double_value < b->double_value;
+    }
+}
+
+/*
+ * @brief Finds the first NaN in an array of a numeric type
+ * @param type Element type
+ * @param data Element array
+ * @param count Number of elements
+ * @return Index of the first NaN, 0 if there is none
+ *
+ * @note Integer types hold no NaN, so they always return 0
+ */
+static size_t vector_numeric_first_nan(data_type_t type, const void *data,
+                                       size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        if (type == DATA_TYPE_FLOAT)
+        {
+            float value = ((const float *)data)[i];
+            if (value != value)
+            {
+                return i;
+            }
+        }
+        else if (type == DATA_TYPE_DOUBLE)
+        {
+            double value = ((const double *)data)[i];
+            if (value != value)
+            {
+                return i;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * @brief Finds the first index of the smallest or largest element
+ * @param vector Target vector
+ * @param type Element type
+ * @param largest true for argmax, false for argmin
+ * @param index Where to store the index
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Reduces fixed-size blocks with the min/max kernel and remembers the
+ * first block holding the best value, then finds it again in that block
+ * only. The data is read once, plus one block that is still in cache
+ * @note The index is always in range: if NaNs make the winning block reduce
+ * to NaN, the block's first NaN is reported
+ */
+static status_t vector_numeric_arg(const vector_t *vector, data_type_t type,
+                                   bool largest, size_t *index)
+{
+    const vector_numeric_kernels_t *kernels =
+        vector_numeric_select(vector, type);
+    if (kernels == NULL || index == NULL)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (vector->size == 0)
+    {
+        return ERROR_EMPTY_CONTAINER;
+    }
+
+    vector_reduce_kernel_t reduce = largest ? kernels->max : kernels->min;
+    const char *data = (const char *)vector->data;
+    size_t width = vector->element_size;
+
+    data_t best;
+    size_t best_start = 0;
+    for (size_t start = 0; start < vector->size; start += VECTOR_NUMERIC_BLOCK)
+    {
+        size_t count = vector->size - start;
+        if (count > VECTOR_NUMERIC_BLOCK)
+        {
+            count = VECTOR_NUMERIC_BLOCK;
+        }
+
+        data_t candidate;
+        reduce(data + start * width, count, &candidate);
+        if (start == 0 ||
+            (largest ? vector_numeric_before(type, &best, &candidate)
+                     : vector_numeric_before(type, &candidate, &best)))
+        {
+            best = candidate;
+            best_start = start;
+        }
+    }
+
+    size_t count = vector->size - best_start;
+    if (count > VECTOR_NUMERIC_BLOCK)
+    {
+        count = VECTOR_NUMERIC_BLOCK;
+    }
+
+    const char *block = data + best_start * width;
+    size_t offset = kernels->find_eq(block, count, &best);
+    if (offset == count)
+    {
+        // Only a NaN result equals nothing; report the block's first NaN
+        offset = vector_numeric_first_nan(type, block, count);
+    }
+    *index = best_start + offset;
+
+    return SUCCESS;
+}
+
+/* ===== NUMERIC OPERATIONS ===== */
+
+int vector_find_eq(const vector_t *vector, data_type_t type, data_t value)
+{
+    const vector_numeric_kernels_t *kernels =
+        vector_numeric_select(vector, type);
+    if (kernels == NULL)
+    {
+        return -1;
+    }
+
+    size_t index = kernels->find_eq(vector->data, vector->size, &value);
+    return index < vector->size ? (int)index : -1;
+}
+
+size_t vector_count_eq(const vector_t *vector, data_type_t type,
+                       data_t value)
+{
+    const vector_numeric_kernels_t *kernels =
+        vector_numeric_select(vector, type);
+    if (kernels == NULL)
+    {
+        return 0;
+    }
+
+    return kernels->count_eq(vector->data, vector->size, &value);
+}
+
+status_t vector_min(const vector_t *vector, data_type_t type, data_t *result)
+{
+    const vector_numeric_kernels_t *kernels =
+        vector_numeric_select(vector, type);
+    if (kernels == NULL || result == NULL)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (vector->size == 0)
+    {
+        return ERROR_EMPTY_CONTAINER;
+    }
+
+    kernels->min(vector->data, vector->size, result);
+    return SUCCESS;
+}
+
+status_t vector_max(const vector_t *vector, data_type_t type, data_t *result)
+{
+    const vector_numeric_kernels_t *kernels =
+        vector_numeric_select(vector, type);
+    if (kernels == NULL || result == NULL)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (vector->size == 0)
+    {
+        return ERROR_EMPTY_CONTAINER;
+    }
+
+    kernels->max(vector->data, vector->size, result);
+    return SUCCESS;
+}
+
+status_t vector_sum(const vector_t *vector, data_type_t type, data_t *result)
+{
+    const vector_numeric_kernels_t *kernels =
+        vector_numeric_select(vector, type);
+    if (kernels == NULL || result == NULL)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    kernels->sum(vector->data, vector->size, result);
+    return SUCCESS;
+}
+
+status_t vector_argmin(const vector_t *vector, data_type_t type,
+                       size_t *index)
+{
+    return vector_numeric_arg(vector, type, false, index);
+}
+
+status_t vector_argmax(const vector_t *vector, data_type_t type,
+                       size_t *index)
+{
+    return vector_numeric_arg(vector, type, true, index);
+}
+
 /* ===== ITERATION ===== */
 
 void vector_for_each(vector_t *vector, void (*func)(void *element))
@@ -16,29 +16,23 @@
 
 /*
  * @brief Creates a new doubly linked list node with copied data
+ * @param list List whose node pool is used
  * @param data Pointer to data to copy into the node
- * @param element_size Size of each element in bytes
  * @return Pointer to new node, NULL on memory allocation failure
  *
  * @note Time complexity: O(1) for allocation, plus O(element_size) for data
  * copy
- * @note Performs deep copy of data into newly allocated memory
- * @warning Returns NULL if memory allocation fails for node or data
+ * @note Node and element share one block recycled through the list's pool
+ * @warning Returns NULL if memory allocation fails
  */
-static doubly_node_t *create_doubly_node(const void *data, size_t element_size)
+static doubly_node_t *create_doubly_node(const doubly_list_t *list,
+                                         const void *data)
 {
-    doubly_node_t *node = (doubly_node_t *)mem_alloc(sizeof(doubly_node_t));
+    doubly_node_t *node = (doubly_node_t *)pool_alloc(list->node_pool);
     if (node == NULL)
         return NULL;
 
-    node->data = mem_alloc(element_size);
-    if (node->data == NULL)
-    {
-        mem_free((void **)&node);
-        return NULL;
-    }
-
-    mem_copy(node->data, data, element_size);
+    mem_copy(node->data, data, list->element_size);
     node->next = NULL;
     node->prev = NULL;
     return node;
@@ -46,18 +40,19 @@ static doubly_node_t *create_doubly_node(const void *data, size_t element_size)
 
 /*
  * @brief Destroys a doubly linked list node and its associated data
+ * @param list List that owns the node
  * @param node Node to destroy
  *
  * @note Time complexity: O(1)
- * @note Safely frees both the node structure and its data memory
+ * @note Returns the node (and its inline data) to the list's pool
  * @note Handles NULL pointer safely (no operation)
  */
-static void destroy_doubly_node(doubly_node_t *node)
+static void destroy_doubly_node(const doubly_list_t *list,
+                                doubly_node_t *node)
 {
     if (node != NULL)
     {
-        mem_free(&node->data);
-        mem_free((void **)&node);
+        pool_free(list->node_pool, node);
     }
 }
 
@@ -103,9 +98,70 @@ static doubly_node_t *get_doubly_node_at(const doubly_list_t *list,
     }
 }
 
+/*
+ * @brief Detaches a node from a list without releasing it
+ * @param list List that holds the node
+ * @param node Node to detach
+ *
+ * @note Time complexity: O(1)
+ */
+static void unlink_doubly_node(doubly_list_t *list, doubly_node_t *node)
+{
+    if (node->prev != NULL)
+    {
+        node->prev->next = node->next;
+    }
+    else
+    {
+        list->head = node->next;
+    }
+
+    if (node->next != NULL)
+    {
+        node->next->prev = node->prev;
+    }
+    else
+    {
+        list->tail = node->prev;
+    }
+
+    list->size--;
+}
+
+/*
+ * @brief Attaches a detached node at the end of a list
+ * @param list Target list
+ * @param node Node to attach
+ *
+ * @note Time complexity: O(1)
+ */
+static void link_doubly_node_back(doubly_list_t *list, doubly_node_t *node)
+{
+    node->next = NULL;
+    node->prev = list->tail;
+
+    if (list->tail != NULL)
+    {
+        list->tail->next = node;
+    }
+    else
+    {
+        list->head = node;
+    }
+
+    list->tail = node;
+    list->size++;
+}
+
 /* ===== LIST CREATION AND DESTRUCTION ===== */
 
 doubly_list_t *doubly_list_create(size_t element_size)
+{
+    return doubly_list_create_with_allocator(element_size, NULL);
+}
+
+doubly_list_t *doubly_list_create_with_allocator(size_t element_size,
+                                                 const allocator_t *allocator)
 {
     if (element_size == 0)
     {
@@ -113,9 +169,16 @@ doubly_list_t *doubly_list_create(size_t element_size)
         return NULL;
     }
 
-    doubly_list_t *list = (doubly_list_t *)mem_alloc(sizeof(doubly_list_t));
+    if (allocator == NULL)
+    {
+        allocator = allocator_default();
+    }
+
+    doubly_list_t *list =
+        (doubly_list_t *)allocator_alloc(allocator, sizeof(doubly_list_t));
     if (list == NULL)
     {
+        fprintf(stderr, "Error: Failed to allocate list structure\n");
         return NULL;
     }
 
@@ -123,6 +186,53 @@ doubly_list_t *doubly_list_create(size_t element_size)
     list->tail = NULL;
     list->size = 0;
     list->element_size = element_size;
+    list->allocator = *allocator;
+
+    // Nodes (with inline data) come from a per-list pool fed by the allocator
+    list->node_pool =
+        pool_create_with_allocator(sizeof(doubly_node_t) + element_size,
+                                   allocator);
+    if (list->node_pool == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate list node pool\n");
+        allocator_free(allocator, list, sizeof(doubly_list_t));
+        return NULL;
+    }
+    list->owns_pool = true;
+
+    return list;
+}
+
+doubly_list_t *doubly_list_create_with_pool(size_t element_size,
+                                            pool_t *pool)
+{
+    if (element_size == 0 || pool == NULL)
+    {
+        fprintf(stderr, "Error: Invalid parameters for list creation\n");
+        return NULL;
+    }
+
+    if (pool->block_size < sizeof(doubly_node_t) + element_size)
+    {
+        fprintf(stderr, "Error: Pool blocks too small for list nodes\n");
+        return NULL;
+    }
+
+    doubly_list_t *list = (doubly_list_t *)allocator_alloc(
+        &pool->backing, sizeof(doubly_list_t));
+    if (list == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate list structure\n");
+        return NULL;
+    }
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+    list->element_size = element_size;
+    list->allocator = pool->backing;
+    list->node_pool = pool;
+    list->owns_pool = false;
 
     return list;
 }
@@ -132,8 +242,19 @@ void doubly_list_destroy(doubly_list_t *list)
     if (list == NULL)
         return;
 
-    doubly_list_clear(list);
-    mem_free((void **)&list);
+    if (list->owns_pool)
+    {
+        pool_destroy(list->node_pool);
+    }
+    else
+    {
+        // A shared pool outlives the list; just hand the nodes back
+        doubly_list_clear(list);
+    }
+
+    // Copy the allocator out: it lives inside the block being freed
+    allocator_t allocator = list->allocator;
+    allocator_free(&allocator, list, sizeof(doubly_list_t));
 }
 
 doubly_list_t *doubly_list_copy(const doubly_list_t *src)
@@ -141,7 +262,8 @@ doubly_list_t *doubly_list_copy(const doubly_list_t *src)
     if (src == NULL)
         return NULL;
 
-    doubly_list_t *dest = doubly_list_create(src->element_size);
+    doubly_list_t *dest =
+        doubly_list_create_with_allocator(src->element_size, &src->allocator);
     if (dest == NULL)
         return NULL;
 
@@ -170,7 +292,7 @@ status_t doubly_list_push_front(doubly_list_t *list, const void *element)
         return ERROR_INVALID_INPUT;
     }
 
-    doubly_node_t *new_node = create_doubly_node(element, list->element_size);
+    doubly_node_t *new_node = create_doubly_node(list, element);
     if (new_node == NULL)
     {
         return ERROR_MEMORY_ALLOCATION;
@@ -202,7 +324,7 @@ status_t doubly_list_push_back(doubly_list_t *list, const void *element)
         return ERROR_INVALID_INPUT;
     }
 
-    doubly_node_t *new_node = create_doubly_node(element, list->element_size);
+    doubly_node_t *new_node = create_doubly_node(list, element);
     if (new_node == NULL)
     {
         return ERROR_MEMORY_ALLOCATION;
@@ -259,7 +381,7 @@ status_t doubly_list_pop_front(doubly_list_t *list, void *output)
         list->tail = NULL;
     }
 
-    destroy_doubly_node(old_head);
+    destroy_doubly_node(list, old_head);
     list->size--;
 
     return SUCCESS;
@@ -297,7 +419,7 @@ status_t doubly_list_pop_back(doubly_list_t *list, void *output)
         list->head = NULL;
     }
 
-    destroy_doubly_node(old_tail);
+    destroy_doubly_node(list, old_tail);
     list->size--;
 
     return SUCCESS;
@@ -334,7 +456,7 @@ status_t doubly_list_insert(doubly_list_t *list, size_t index,
     }
 
     // Insert before current node
-    doubly_node_t *new_node = create_doubly_node(element, list->element_size);
+    doubly_node_t *new_node = create_doubly_node(list, element);
     if (new_node == NULL)
     {
         return ERROR_MEMORY_ALLOCATION;
@@ -393,7 +515,7 @@ status_t doubly_list_remove(doubly_list_t *list, size_t index)
         to_remove->next->prev = to_remove->prev;
     }
 
-    destroy_doubly_node(to_remove);
+    destroy_doubly_node(list, to_remove);
     list->size--;
 
     return SUCCESS;
@@ -408,7 +530,7 @@ void doubly_list_clear(doubly_list_t *list)
     while (current != NULL)
     {
         doubly_node_t *next = current->next;
-        destroy_doubly_node(current);
+        destroy_doubly_node(list, current);
         current = next;
     }
 
@@ -519,7 +641,7 @@ status_t doubly_list_insert_before(doubly_list_t *list, doubly_node_t *node,
         return ERROR_INVALID_INPUT;
     }
 
-    doubly_node_t *new_node = create_doubly_node(element, list->element_size);
+    doubly_node_t *new_node = create_doubly_node(list, element);
     if (new_node == NULL)
     {
         return ERROR_MEMORY_ALLOCATION;
@@ -552,7 +674,7 @@ status_t doubly_list_insert_after(doubly_list_t *list, doubly_node_t *node,
         return ERROR_INVALID_INPUT;
     }
 
-    doubly_node_t *new_node = create_doubly_node(element, list->element_size);
+    doubly_node_t *new_node = create_doubly_node(list, element);
     if (new_node == NULL)
     {
         return ERROR_MEMORY_ALLOCATION;
@@ -577,6 +699,104 @@ status_t doubly_list_insert_after(doubly_list_t *list, doubly_node_t *node,
     return SUCCESS;
 }
 
+/* ===== NODE OPERATIONS ===== */
+
+doubly_node_t *doubly_list_push_back_node(doubly_list_t *list,
+                                          const void *element)
+{
+    if (list == NULL)
+    {
+        return NULL;
+    }
+
+    doubly_node_t *new_node = (doubly_node_t *)pool_alloc(list->node_pool);
+    if (new_node == NULL)
+    {
+        return NULL;
+    }
+
+    if (element != NULL)
+    {
+        mem_copy(new_node->data, element, list->element_size);
+    }
+    link_doubly_node_back(list, new_node);
+    return new_node;
+}
+
+status_t doubly_list_erase_node(doubly_list_t *list, doubly_node_t *node)
+{
+    if (list == NULL || node == NULL || list->size == 0)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    unlink_doubly_node(list, node);
+    destroy_doubly_node(list, node);
+
+    return SUCCESS;
+}
+
+status_t doubly_list_move_node_back(doubly_list_t *dest, doubly_list_t *src,
+                                    doubly_node_t *node)
+{
+    if (dest == NULL || src == NULL || node == NULL || src->size == 0)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (dest->node_pool != src->node_pool)
+    {
+        fprintf(stderr, "Error: Cannot move nodes between lists with "
+                        "different pools\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    unlink_doubly_node(src, node);
+    link_doubly_node_back(dest, node);
+
+    return SUCCESS;
+}
+
+status_t doubly_list_splice_back(doubly_list_t *dest, doubly_list_t *src)
+{
+    if (dest == NULL || src == NULL)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (dest->node_pool != src->node_pool)
+    {
+        fprintf(stderr, "Error: Cannot splice lists with different "
+                        "pools\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (dest == src || src->head == NULL)
+    {
+        return SUCCESS;
+    }
+
+    // Join src's chain onto dest's tail
+    if (dest->tail != NULL)
+    {
+        dest->tail->next = src->head;
+        src->head->prev = dest->tail;
+    }
+    else
+    {
+        dest->head = src->head;
+    }
+
+    dest->tail = src->tail;
+    dest->size += src->size;
+
+    src->head = NULL;
+    src->tail = NULL;
+    src->size = 0;
+
+    return SUCCESS;
+}
+
 /* ===== UTILITY OPERATIONS ===== */
 
 status_t doubly_list_reverse(doubly_list_t *list)
@@ -615,6 +835,13 @@ void doubly_list_swap(doubly_list_t *a, doubly_list_t *b)
     if (a == NULL || b == NULL)
         return;
 
+    if (!allocator_equal(&a->allocator, &b->allocator))
+    {
+        fprintf(stderr, "Error: Cannot swap lists with different "
+                        "allocators\n");
+        return;
+    }
+
     // Swap all fields
     doubly_node_t *temp_head = a->head;
     a->head = b->head;
@@ -631,6 +858,15 @@ void doubly_list_swap(doubly_list_t *a, doubly_list_t *b)
     size_t temp_element_size = a->element_size;
     a->element_size = b->element_size;
     b->element_size = temp_element_size;
+
+    // Nodes stay with the pool they were carved from
+    pool_t *temp_pool = a->node_pool;
+    a->node_pool = b->node_pool;
+    b->node_pool = temp_pool;
+
+    bool temp_owns_pool = a->owns_pool;
+    a->owns_pool = b->owns_pool;
+    b->owns_pool = temp_owns_pool;
 }
 
 /* ===== ITERATION IMPLEMENTATION ===== */
@@ -730,6 +966,6 @@ status_t doubly_list_iter_remove(doubly_list_iter_t *iter)
     iter->current = next;
     iter->list->size--;
 
-    destroy_doubly_node(to_remove);
+    destroy_doubly_node(iter->list, to_remove);
     return SUCCESS;
 }
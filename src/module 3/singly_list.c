@@ -16,47 +16,41 @@
 
 /*
  * @brief Creates a new singly linked list node with copied data
+ * @param list List whose node pool is used
  * @param data Pointer to data to copy into the node
- * @param element_size Size of each element in bytes
  * @return Pointer to new node, NULL on memory allocation failure
  *
  * @note Time complexity: O(1) for allocation, plus O(element_size) for data
  * copy
- * @note Performs deep copy of data into newly allocated memory
- * @warning Returns NULL if memory allocation fails for node or data
+ * @note Node and element share one block recycled through the list's pool
+ * @warning Returns NULL if memory allocation fails
  */
-static singly_node_t *create_node(const void *data, size_t element_size)
+static singly_node_t *create_node(const singly_list_t *list,
+                                  const void *data)
 {
-    singly_node_t *node = (singly_node_t *)mem_alloc(sizeof(singly_node_t));
+    singly_node_t *node = (singly_node_t *)pool_alloc(list->node_pool);
     if (node == NULL)
         return NULL;
 
-    node->data = mem_alloc(element_size);
-    if (node->data == NULL)
-    {
-        mem_free((void **)&node);
-        return NULL;
-    }
-
-    mem_copy(node->data, data, element_size);
+    mem_copy(node->data, data, list->element_size);
     node->next = NULL;
     return node;
 }
 
 /*
  * @brief Destroys a singly linked list node and its associated data
+ * @param list List that owns the node
  * @param node Node to destroy
  *
  * @note Time complexity: O(1)
- * @note Safely frees both the node structure and its data memory
+ * @note Returns the node (and its inline data) to the list's pool
  * @note Handles NULL pointer safely (no operation)
  */
-static void destroy_node(singly_node_t *node)
+static void destroy_node(const singly_list_t *list, singly_node_t *node)
 {
     if (node != NULL)
     {
-        mem_free(&node->data);
-        mem_free((void **)&node);
+        pool_free(list->node_pool, node);
     }
 }
 
@@ -89,6 +83,12 @@ static singly_node_t *get_node_at(const singly_list_t *list, size_t index)
 /* ===== LIST CREATION AND DESTRUCTION ===== */
 
 singly_list_t *singly_list_create(size_t element_size)
+{
+    return singly_list_create_with_allocator(element_size, NULL);
+}
+
+singly_list_t *singly_list_create_with_allocator(size_t element_size,
+                                                 const allocator_t *allocator)
 {
     if (element_size == 0)
     {
@@ -96,7 +96,13 @@ singly_list_t *singly_list_create(size_t element_size)
         return NULL;
     }
 
-    singly_list_t *list = (singly_list_t *)mem_alloc(sizeof(singly_list_t));
+    if (allocator == NULL)
+    {
+        allocator = allocator_default();
+    }
+
+    singly_list_t *list =
+        (singly_list_t *)allocator_alloc(allocator, sizeof(singly_list_t));
     if (list == NULL)
     {
         return NULL;
@@ -106,6 +112,17 @@ singly_list_t *singly_list_create(size_t element_size)
     list->tail = NULL;
     list->size = 0;
     list->element_size = element_size;
+    list->allocator = *allocator;
+
+    // Nodes (with inline data) come from a per-list pool fed by the allocator
+    list->node_pool =
+        pool_create_with_allocator(sizeof(singly_node_t) + element_size,
+                                   allocator);
+    if (list->node_pool == NULL)
+    {
+        allocator_free(allocator, list, sizeof(singly_list_t));
+        return NULL;
+    }
 
     return list;
 }
@@ -115,8 +132,11 @@ void singly_list_destroy(singly_list_t *list)
     if (list == NULL)
         return;
 
-    singly_list_clear(list);
-    mem_free((void **)&list);
+    pool_destroy(list->node_pool);
+
+    // Copy the allocator out: it lives inside the block being freed
+    allocator_t allocator = list->allocator;
+    allocator_free(&allocator, list, sizeof(singly_list_t));
 }
 
 singly_list_t *singly_list_copy(const singly_list_t *src)
@@ -124,7 +144,8 @@ singly_list_t *singly_list_copy(const singly_list_t *src)
     if (src == NULL)
         return NULL;
 
-    singly_list_t *dest = singly_list_create(src->element_size);
+    singly_list_t *dest =
+        singly_list_create_with_allocator(src->element_size, &src->allocator);
     if (dest == NULL)
         return NULL;
 
@@ -153,7 +174,7 @@ status_t singly_list_push_front(singly_list_t *list, const void *element)
         return ERROR_INVALID_INPUT;
     }
 
-    singly_node_t *new_node = create_node(element, list->element_size);
+    singly_node_t *new_node = create_node(list, element);
     if (new_node == NULL)
     {
         return ERROR_MEMORY_ALLOCATION;
@@ -179,7 +200,7 @@ status_t singly_list_push_back(singly_list_t *list, const void *element)
         return ERROR_INVALID_INPUT;
     }
 
-    singly_node_t *new_node = create_node(element, list->element_size);
+    singly_node_t *new_node = create_node(list, element);
     if (new_node == NULL)
     {
         return ERROR_MEMORY_ALLOCATION;
@@ -229,7 +250,7 @@ status_t singly_list_pop_front(singly_list_t *list, void *output)
         list->tail = NULL;
     }
 
-    destroy_node(old_head);
+    destroy_node(list, old_head);
     list->size--;
 
     return SUCCESS;
@@ -256,7 +277,7 @@ status_t singly_list_pop_back(singly_list_t *list, void *output)
     if (list->head == list->tail)
     {
         // Only one element
-        destroy_node(list->head);
+        destroy_node(list, list->head);
         list->head = NULL;
         list->tail = NULL;
     }
@@ -269,7 +290,7 @@ status_t singly_list_pop_back(singly_list_t *list, void *output)
             current = current->next;
         }
 
-        destroy_node(list->tail);
+        destroy_node(list, list->tail);
         current->next = NULL;
         list->tail = current;
     }
@@ -308,7 +329,7 @@ status_t singly_list_insert(singly_list_t *list, size_t index,
         return ERROR_INDEX_OUT_OF_BOUNDS;
     }
 
-    singly_node_t *new_node = create_node(element, list->element_size);
+    singly_node_t *new_node = create_node(list, element);
     if (new_node == NULL)
     {
         return ERROR_MEMORY_ALLOCATION;
@@ -355,7 +376,7 @@ status_t singly_list_remove(singly_list_t *list, size_t index)
         list->tail = prev;
     }
 
-    destroy_node(to_remove);
+    destroy_node(list, to_remove);
     list->size--;
 
     return SUCCESS;
@@ -370,7 +391,7 @@ void singly_list_clear(singly_list_t *list)
     while (current != NULL)
     {
         singly_node_t *next = current->next;
-        destroy_node(current);
+        destroy_node(list, current);
         current = next;
     }
 
@@ -508,6 +529,13 @@ void singly_list_swap(singly_list_t *a, singly_list_t *b)
     if (a == NULL || b == NULL)
         return;
 
+    if (!allocator_equal(&a->allocator, &b->allocator))
+    {
+        fprintf(stderr, "Error: Cannot swap lists with different "
+                        "allocators\n");
+        return;
+    }
+
     // Swap all fields
     singly_node_t *temp_head = a->head;
     a->head = b->head;
@@ -524,6 +552,11 @@ void singly_list_swap(singly_list_t *a, singly_list_t *b)
     size_t temp_element_size = a->element_size;
     a->element_size = b->element_size;
     b->element_size = temp_element_size;
+
+    // Nodes stay with the pool they were carved from
+    pool_t *temp_pool = a->node_pool;
+    a->node_pool = b->node_pool;
+    b->node_pool = temp_pool;
 }
 
 /* ===== ITERATION IMPLEMENTATION ===== */
@@ -6,13 +6,195 @@
  * @date 2024
  *
  * CStructs+ Library - Deque Module
- * Provides deque implementation using doubly linked list
+ * Provides deque implementation using a growable circular buffer, plus a
+ * Chase-Lev work-stealing deque for schedulers
  */
 
 #include "../../include/module 4/deque.h"
 #include <stdio.h>
 
-deque_t *deque_create(size_t element_size)
+/* ===== CONSTANTS ===== */
+
+#define DEQUE_INITIAL_CAPACITY 16
+#define DEQUE_GROWTH_FACTOR 2
+
+/* ===== HELPER FUNCTIONS ===== */
+
+/*
+ * @brief Maps a logical index to its physical slot
+ * @param deque Target deque
+ * @param index Logical index (may be past size, wraps around)
+ * @return Physical slot in the buffer
+ *
+ * @note Time complexity: O(1)
+ */
+static inline size_t deque_slot(const deque_t *deque, size_t index)
+{
+    return (deque->head + index) & (deque->capacity - 1);
+}
+
+/*
+ * @brief Gets the address of a logical index
+ * @param deque Target deque
+ * @param index Logical index
+ * @return Pointer to the element's slot
+ *
+ * @note Time complexity: O(1)
+ */
+static inline char *deque_at(const deque_t *deque, size_t index)
+{
+    return (char *)deque->data + deque_slot(deque, index) * deque->element_size;
+}
+
+/*
+ * @brief Copies a logical range into a contiguous buffer
+ * @param deque Source deque
+ * @param index First logical index
+ * @param count Number of elements
+ * @param output Destination buffer
+ *
+ * @note Time complexity: O(count)
+ * @note The range wraps at most once, so two block copies suffice
+ */
+static void deque_copy_out(const deque_t *deque, size_t index, size_t count,
+                           void *output)
+{
+    size_t first = deque_slot(deque, index);
+    size_t run = deque->capacity - first;
+    if (run > count)
+    {
+        run = count;
+    }
+
+    mem_copy(output, (char *)deque->data + first * deque->element_size,
+             run * deque->element_size);
+    if (count > run)
+    {
+        mem_copy((char *)output + run * deque->element_size, deque->data,
+                 (count - run) * deque->element_size);
+    }
+}
+
+/*
+ * @brief Moves a logical range of elements to another logical position
+ * @param deque Target deque
+ * @param dest First destination index
+ * @param src First source index
+ * @param count Number of elements to move
+ *
+ * @note Time complexity: O(count)
+ * @note Splits the move into runs contiguous in both source and destination
+ * and orders them like memmove, so overlapping ranges are safe
+ */
+static void deque_shift(deque_t *deque, size_t dest, size_t src, size_t count)
+{
+    size_t width = deque->element_size;
+    char *base = (char *)deque->data;
+
+    if (dest < src)
+    {
+        // Moving towards the front: copy runs front to back
+        while (count > 0)
+        {
+            size_t s = deque_slot(deque, src);
+            size_t d = deque_slot(deque, dest);
+            size_t run = deque->capacity - (s > d ? s : d);
+            if (run > count)
+            {
+                run = count;
+            }
+
+            mem_move(base + d * width, base + s * width, run * width);
+            src += run;
+            dest += run;
+            count -= run;
+        }
+    }
+    else
+    {
+        // Moving towards the back: copy runs back to front
+        while (count > 0)
+        {
+            size_t s = deque_slot(deque, src + count - 1);
+            size_t d = deque_slot(deque, dest + count - 1);
+            size_t run = (s < d ? s : d) + 1;
+            if (run > count)
+            {
+                run = count;
+            }
+
+            count -= run;
+            mem_move(base + (d + 1 - run) * width, base + (s + 1 - run) * width,
+                     run * width);
+        }
+    }
+}
+
+/*
+ * @brief Reallocates the buffer and unwraps the elements to slot 0
+ * @param deque Target deque
+ * @param new_capacity New capacity (power of two, >= size)
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(n) where n is current size
+ */
+static status_t deque_resize(deque_t *deque, size_t new_capacity)
+{
+    void *new_data =
+        allocator_alloc(&deque->allocator, new_capacity * deque->element_size);
+    if (new_data == NULL)
+    {
+        fprintf(stderr,
+                "Error: Failed to allocate new deque data of size %zu\n",
+                new_capacity * deque->element_size);
+        return ERROR_MEMORY_ALLOCATION;
+    }
+
+    deque_copy_out(deque, 0, deque->size, new_data);
+
+    allocator_free(&deque->allocator, deque->data,
+                   deque->capacity * deque->element_size);
+    deque->data = new_data;
+    deque->capacity = new_capacity;
+    deque->head = 0;
+
+    return SUCCESS;
+}
+
+/*
+ * @brief Checks if deque needs to grow and resizes if necessary
+ * @param deque Target deque
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(1) amortized
+ * @note Used internally before every insertion
+ */
+static status_t deque_check_grow(deque_t *deque)
+{
+    if (deque->size < deque->capacity)
+    {
+        return SUCCESS;
+    }
+
+    size_t new_capacity = deque->capacity * DEQUE_GROWTH_FACTOR;
+    if (new_capacity <= deque->capacity)
+    {
+        fprintf(stderr, "Error: Deque capacity overflow\n");
+        return ERROR_MEMORY_ALLOCATION;
+    }
+
+    return deque_resize(deque, new_capacity);
+}
+
+/*
+ * @brief Allocates and initializes a deque
+ * @param element_size Size of each element in bytes
+ * @param capacity Requested capacity (0 selects the default)
+ * @param allocator Allocator to use (NULL selects the default allocator)
+ * @return Pointer to new deque, NULL on failure
+ */
+static deque_t *deque_create_internal(size_t element_size, size_t capacity,
+                                      const allocator_t *allocator)
 {
     // Validate input parameters
     if (element_size == 0)
@@ -21,32 +203,79 @@ deque_t *deque_create(size_t element_size)
         return NULL;
     }
 
+    if (capacity == 0)
+    {
+        capacity = DEQUE_INITIAL_CAPACITY;
+    }
+
+    capacity = next_power_of_two(capacity);
+    if (capacity == 0)
+    {
+        fprintf(stderr, "Error: Deque capacity too large\n");
+        return NULL;
+    }
+
+    if (allocator == NULL)
+    {
+        allocator = allocator_default();
+    }
+
     // Allocate deque structure
-    deque_t *deque = (deque_t *)mem_alloc(sizeof(deque_t));
+    deque_t *deque = (deque_t *)allocator_alloc(allocator, sizeof(deque_t));
     if (deque == NULL)
     {
         fprintf(stderr, "Error: Failed to allocate deque structure\n");
         return NULL;
     }
 
-    // Create underlying doubly linked list
-    deque->list = doubly_list_create(element_size);
-    if (deque->list == NULL)
+    // Allocate circular buffer
+    deque->data = allocator_alloc(allocator, capacity * element_size);
+    if (deque->data == NULL)
     {
-        fprintf(stderr, "Error: Failed to create underlying list for deque\n");
-        mem_free((void **)&deque);
+        fprintf(stderr, "Error: Failed to allocate deque data of size %zu\n",
+                capacity * element_size);
+        allocator_free(allocator, deque, sizeof(deque_t));
         return NULL;
     }
 
+    // Initialize deque state
+    deque->head = 0;
+    deque->size = 0;
+    deque->capacity = capacity;
+    deque->element_size = element_size;
+    deque->allocator = *allocator;
+
     return deque;
 }
 
+/* ===== DEQUE IMPLEMENTATION ===== */
+
+deque_t *deque_create(size_t element_size)
+{
+    return deque_create_internal(element_size, DEQUE_INITIAL_CAPACITY, NULL);
+}
+
+deque_t *deque_create_with_capacity(size_t element_size, size_t capacity)
+{
+    return deque_create_internal(element_size, capacity, NULL);
+}
+
+deque_t *deque_create_with_allocator(size_t element_size,
+                                     const allocator_t *allocator)
+{
+    return deque_create_internal(element_size, DEQUE_INITIAL_CAPACITY,
+                                 allocator);
+}
+
 void deque_destroy(deque_t *deque)
 {
     if (deque != NULL)
     {
-        doubly_list_destroy(deque->list);
-        mem_free((void **)&deque);
+        // Copy the allocator out: it lives inside the block being freed
+        allocator_t allocator = deque->allocator;
+        allocator_free(&allocator, deque->data,
+                       deque->capacity * deque->element_size);
+        allocator_free(&allocator, deque, sizeof(deque_t));
     }
 }
 
@@ -60,7 +289,18 @@ status_t deque_push_front(deque_t *deque, const void *element)
         return ERROR_INVALID_INPUT;
     }
 
-    return doubly_list_push_front(deque->list, element);
+    status_t result = deque_check_grow(deque);
+    if (result != SUCCESS)
+    {
+        return result;
+    }
+
+    // Step head back one slot (wrapping) and store there
+    deque->head = (deque->head - 1) & (deque->capacity - 1);
+    mem_copy(deque_at(deque, 0), element, deque->element_size);
+    deque->size++;
+
+    return SUCCESS;
 }
 
 status_t deque_push_back(deque_t *deque, const void *element)
@@ -73,7 +313,16 @@ status_t deque_push_back(deque_t *deque, const void *element)
         return ERROR_INVALID_INPUT;
     }
 
-    return doubly_list_push_back(deque->list, element);
+    status_t result = deque_check_grow(deque);
+    if (result != SUCCESS)
+    {
+        return result;
+    }
+
+    mem_copy(deque_at(deque, deque->size), element, deque->element_size);
+    deque->size++;
+
+    return SUCCESS;
 }
 
 status_t deque_pop_front(deque_t *deque, void *output)
@@ -86,7 +335,20 @@ status_t deque_pop_front(deque_t *deque, void *output)
         return ERROR_INVALID_INPUT;
     }
 
-    return doubly_list_pop_front(deque->list, output);
+    if (deque->size == 0)
+    {
+        return ERROR_EMPTY_CONTAINER;
+    }
+
+    if (output != NULL)
+    {
+        mem_copy(output, deque_at(deque, 0), deque->element_size);
+    }
+
+    deque->head = deque_slot(deque, 1);
+    deque->size--;
+
+    return SUCCESS;
 }
 
 status_t deque_pop_back(deque_t *deque, void *output)
@@ -99,7 +361,18 @@ status_t deque_pop_back(deque_t *deque, void *output)
         return ERROR_INVALID_INPUT;
     }
 
-    return doubly_list_pop_back(deque->list, output);
+    if (deque->size == 0)
+    {
+        return ERROR_EMPTY_CONTAINER;
+    }
+
+    deque->size--;
+    if (output != NULL)
+    {
+        mem_copy(output, deque_at(deque, deque->size), deque->element_size);
+    }
+
+    return SUCCESS;
 }
 
 status_t deque_peek_front(const deque_t *deque, void *output)
@@ -112,7 +385,13 @@ status_t deque_peek_front(const deque_t *deque, void *output)
         return ERROR_INVALID_INPUT;
     }
 
-    return doubly_list_get(deque->list, 0, output);
+    if (deque->size == 0)
+    {
+        return ERROR_EMPTY_CONTAINER;
+    }
+
+    mem_copy(output, deque_at(deque, 0), deque->element_size);
+    return SUCCESS;
 }
 
 status_t deque_peek_back(const deque_t *deque, void *output)
@@ -126,35 +405,39 @@ status_t deque_peek_back(const deque_t *deque, void *output)
     }
 
     // Check if deque is empty
-    if (doubly_list_empty(deque->list))
+    if (deque->size == 0)
     {
         fprintf(stderr, "Error: Cannot peek from empty deque\n");
         return ERROR_EMPTY_CONTAINER;
     }
 
-    // Get the last element (back of deque)
-    return doubly_list_get(deque->list, doubly_list_size(deque->list) - 1,
-                           output);
+    mem_copy(output, deque_at(deque, deque->size - 1), deque->element_size);
+    return SUCCESS;
 }
 
 void *deque_peek_front_ref(const deque_t *deque)
 {
-    return deque != NULL ? doubly_list_front(deque->list) : NULL;
+    return deque_get_ref(deque, 0);
 }
 
 void *deque_peek_back_ref(const deque_t *deque)
 {
-    return deque != NULL ? doubly_list_back(deque->list) : NULL;
+    if (deque == NULL || deque->size == 0)
+    {
+        return NULL;
+    }
+
+    return deque_at(deque, deque->size - 1);
 }
 
 size_t deque_size(const deque_t *deque)
 {
-    return deque != NULL ? doubly_list_size(deque->list) : 0;
+    return deque != NULL ? deque->size : 0;
 }
 
 bool deque_empty(const deque_t *deque)
 {
-    return deque == NULL || doubly_list_empty(deque->list);
+    return deque == NULL || deque->size == 0;
 }
 
 status_t deque_insert(deque_t *deque, size_t index, const void *element)
@@ -166,7 +449,33 @@ status_t deque_insert(deque_t *deque, size_t index, const void *element)
         return ERROR_INVALID_INPUT;
     }
 
-    return doubly_list_insert(deque->list, index, element);
+    if (index > deque->size)
+    {
+        return ERROR_INDEX_OUT_OF_BOUNDS;
+    }
+
+    status_t result = deque_check_grow(deque);
+    if (result != SUCCESS)
+    {
+        return result;
+    }
+
+    if (index < deque->size - index)
+    {
+        // Fewer elements before the gap: slide the front one slot back
+        deque->head = (deque->head - 1) & (deque->capacity - 1);
+        deque_shift(deque, 0, 1, index);
+    }
+    else
+    {
+        // Fewer elements after the gap: slide the back one slot forward
+        deque_shift(deque, index + 1, index, deque->size - index);
+    }
+
+    mem_copy(deque_at(deque, index), element, deque->element_size);
+    deque->size++;
+
+    return SUCCESS;
 }
 
 status_t deque_remove(deque_t *deque, size_t index)
@@ -178,7 +487,26 @@ status_t deque_remove(deque_t *deque, size_t index)
         return ERROR_INVALID_INPUT;
     }
 
-    return doubly_list_remove(deque->list, index);
+    if (index >= deque->size)
+    {
+        return ERROR_INDEX_OUT_OF_BOUNDS;
+    }
+
+    if (index < deque->size - 1 - index)
+    {
+        // Close the gap from the front
+        deque_shift(deque, 1, 0, index);
+        deque->head = deque_slot(deque, 1);
+    }
+    else
+    {
+        // Close the gap from the back
+        deque_shift(deque, index, index + 1, deque->size - 1 - index);
+    }
+
+    deque->size--;
+
+    return SUCCESS;
 }
 
 status_t deque_get(deque_t *deque, size_t index, void *output)
@@ -190,7 +518,13 @@ status_t deque_get(deque_t *deque, size_t index, void *output)
         return ERROR_INVALID_INPUT;
     }
 
-    return doubly_list_get(deque->list, index, output);
+    if (index >= deque->size)
+    {
+        return ERROR_INDEX_OUT_OF_BOUNDS;
+    }
+
+    mem_copy(output, deque_at(deque, index), deque->element_size);
+    return SUCCESS;
 }
 
 status_t deque_set(deque_t *deque, size_t index, const void *element)
@@ -202,5 +536,370 @@ status_t deque_set(deque_t *deque, size_t index, const void *element)
         return ERROR_INVALID_INPUT;
     }
 
-    return doubly_list_set(deque->list, index, element);
+    if (index >= deque->size)
+    {
+        return ERROR_INDEX_OUT_OF_BOUNDS;
+    }
+
+    mem_copy(deque_at(deque, index), element, deque->element_size);
+    return SUCCESS;
+}
+
+void *deque_get_ref(const deque_t *deque, size_t index)
+{
+    if (deque == NULL || index >= deque->size)
+    {
+        return NULL;
+    }
+
+    return deque_at(deque, index);
+}
+
+status_t deque_copy_to(const deque_t *deque, size_t index, size_t count,
+                       void *output)
+{
+    // Validate input parameters
+    if (deque == NULL || (output == NULL && count > 0))
+    {
+        fprintf(stderr, "Error: Invalid input parameters for deque copy_to\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (index > deque->size || count > deque->size - index)
+    {
+        return ERROR_INDEX_OUT_OF_BOUNDS;
+    }
+
+    if (count > 0)
+    {
+        deque_copy_out(deque, index, count, output);
+    }
+
+    return SUCCESS;
+}
+
+void deque_clear(deque_t *deque)
+{
+    if (deque != NULL)
+    {
+        deque->head = 0;
+        deque->size = 0;
+    }
+}
+
+/* ===== WORK-STEALING DEQUE IMPLEMENTATION ===== */
+
+/*
+ * @brief Allocates a slot array for a work-stealing deque
+ * @param deque Deque supplying the allocator and element size
+ * @param capacity Number of slots (power of two)
+ * @return Pointer to new array, NULL on failure
+ */
+static deque_ws_array_t *deque_ws_array_create(const deque_ws_t *deque,
+                                               size_t capacity)
+{
+    deque_ws_array_t *array = (deque_ws_array_t *)allocator_alloc(
+        &deque->allocator,
+        sizeof(deque_ws_array_t) + capacity * deque->element_size);
+    if (array == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate deque array of %zu slots\n",
+                capacity);
+        return NULL;
+    }
+
+    array->mask = capacity - 1;
+    array->retired = NULL;
+
+    return array;
+}
+
+/*
+ * @brief Gets the address of the slot for an index
+ * @param deque Deque supplying the element size
+ * @param array Slot array
+ * @param index Free-running index
+ * @return Pointer to the slot
+ */
+static inline unsigned char *deque_ws_slot(const deque_ws_t *deque,
+                                           const deque_ws_array_t *array,
+                                           intptr_t index)
+{
+    return (unsigned char *)array->data +
+           ((size_t)index & array->mask) * deque->element_size;
+}
+
+/*
+ * @brief Replaces the array with one twice as large (owner only)
+ * @param deque Target deque
+ * @param array Current array
+ * @param top Current top index
+ * @param bottom Current bottom index
+ * @return New array, NULL on failure
+ *
+ * @note Time complexity: O(n) where n is the number of elements
+ * @note Live elements keep their indices, so concurrent thieves see the same
+ * element through either array
+ */
+static deque_ws_array_t *deque_ws_grow(deque_ws_t *deque,
+                                       deque_ws_array_t *array, intptr_t top,
+                                       intptr_t bottom)
+{
+    size_t capacity = (array->mask + 1) * DEQUE_GROWTH_FACTOR;
+    if (capacity <= array->mask + 1)
+    {
+        fprintf(stderr, "Error: Deque capacity overflow\n");
+        return NULL;
+    }
+
+    deque_ws_array_t *grown = deque_ws_array_create(deque, capacity);
+    if (grown == NULL)
+    {
+        return NULL;
+    }
+
+    for (intptr_t i = top; i < bottom; i++)
+    {
+        mem_copy(deque_ws_slot(deque, grown, i),
+                 deque_ws_slot(deque, array, i), deque->element_size);
+    }
+
+    // Thieves may still hold the old array; free it only at destroy
+    grown->retired = array;
+    atomic_store_explicit(&deque->array, grown, memory_order_release);
+
+    return grown;
+}
+
+deque_ws_t *deque_ws_create(size_t element_size, size_t capacity)
+{
+    return deque_ws_create_with_allocator(element_size, capacity, NULL);
+}
+
+deque_ws_t *deque_ws_create_with_allocator(size_t element_size,
+                                           size_t capacity,
+                                           const allocator_t *allocator)
+{
+    // Validate input parameters
+    if (element_size == 0)
+    {
+        fprintf(stderr, "Error: Cannot create deque with element size 0\n");
+        return NULL;
+    }
+
+    if (capacity == 0)
+    {
+        capacity = DEQUE_INITIAL_CAPACITY;
+    }
+
+    capacity = next_power_of_two(capacity);
+    if (capacity == 0)
+    {
+        fprintf(stderr, "Error: Deque capacity too large\n");
+        return NULL;
+    }
+
+    if (allocator == NULL)
+    {
+        allocator = allocator_default();
+    }
+
+    // Allocate deque structure
+    deque_ws_t *deque =
+        (deque_ws_t *)allocator_alloc(allocator, sizeof(deque_ws_t));
+    if (deque == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate deque structure\n");
+        return NULL;
+    }
+
+    deque->element_size = element_size;
+    deque->allocator = *allocator;
+
+    deque_ws_array_t *array = deque_ws_array_create(deque, capacity);
+    if (array == NULL)
+    {
+        allocator_free(allocator, deque, sizeof(deque_ws_t));
+        return NULL;
+    }
+
+    // Initialize deque state
+    atomic_init(&deque->array, array);
+    atomic_init(&deque->top, 0);
+    atomic_init(&deque->bottom, 0);
+
+    return deque;
+}
+
+void deque_ws_destroy(deque_ws_t *deque)
+{
+    if (deque == NULL)
+    {
+        return;
+    }
+
+    // Copy the allocator out: it lives inside the block being freed
+    allocator_t allocator = deque->allocator;
+
+    deque_ws_array_t *array =
+        atomic_load_explicit(&deque->array, memory_order_relaxed);
+    while (array != NULL)
+    {
+        deque_ws_array_t *retired = array->retired;
+        allocator_free(&allocator, array,
+                       sizeof(deque_ws_array_t) +
+                           (array->mask + 1) * deque->element_size);
+        array = retired;
+    }
+
+    allocator_free(&allocator, deque, sizeof(deque_ws_t));
+}
+
+status_t deque_ws_push(deque_ws_t *deque, const void *element)
+{
+    // Validate input parameters
+    if (deque == NULL || element == NULL)
+    {
+        fprintf(stderr, "Error: Invalid input parameters for deque push\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    intptr_t bottom =
+        atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    intptr_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    deque_ws_array_t *array =
+        atomic_load_explicit(&deque->array, memory_order_relaxed);
+
+    if ((size_t)(bottom - top) > array->mask)
+    {
+        array = deque_ws_grow(deque, array, top, bottom);
+        if (array == NULL)
+        {
+            return ERROR_MEMORY_ALLOCATION;
+        }
+    }
+
+    mem_copy(deque_ws_slot(deque, array, bottom), element,
+             deque->element_size);
+
+    // Release publishes the element before thieves can see the new bottom
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_release);
+
+    return SUCCESS;
+}
+
+status_t deque_ws_pop(deque_ws_t *deque, void *output)
+{
+    // Validate input parameters
+    if (deque == NULL)
+    {
+        fprintf(stderr, "Error: Invalid deque pointer for pop operation\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    // Claim the bottom element before looking at top
+    intptr_t bottom =
+        atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    deque_ws_array_t *array =
+        atomic_load_explicit(&deque->array, memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    intptr_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        // Already empty: undo the claim
+        atomic_store_explicit(&deque->bottom, bottom + 1,
+                              memory_order_relaxed);
+        return ERROR_EMPTY_CONTAINER;
+    }
+
+    if (top == bottom)
+    {
+        // Last element: race thieves for it through top
+        bool won = atomic_compare_exchange_strong_explicit(
+            &deque->top, &top, top + 1, memory_order_seq_cst,
+            memory_order_relaxed);
+        atomic_store_explicit(&deque->bottom, bottom + 1,
+                              memory_order_relaxed);
+        if (!won)
+        {
+            return ERROR_EMPTY_CONTAINER;
+        }
+    }
+
+    // Thieves never write slots, so the element is intact either way
+    if (output != NULL)
+    {
+        mem_copy(output, deque_ws_slot(deque, array, bottom),
+                 deque->element_size);
+    }
+
+    return SUCCESS;
+}
+
+status_t deque_ws_steal(deque_ws_t *deque, void *output)
+{
+    // Validate input parameters
+    if (deque == NULL)
+    {
+        fprintf(stderr, "Error: Invalid deque pointer for steal operation\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    for (;;)
+    {
+        intptr_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+        atomic_thread_fence(memory_order_seq_cst);
+        intptr_t bottom =
+            atomic_load_explicit(&deque->bottom, memory_order_acquire);
+
+        if (top >= bottom)
+        {
+            return ERROR_EMPTY_CONTAINER;
+        }
+
+        // Copy before claiming: once top moves the owner may reuse the slot.
+        // If another thread claims it first the owner can be refilling the
+        // slot while we read; the CAS below then fails and the copy is
+        // discarded
+        deque_ws_array_t *array =
+            atomic_load_explicit(&deque->array, memory_order_acquire);
+        if (output != NULL)
+        {
+            mem_copy(output, deque_ws_slot(deque, array, top),
+                     deque->element_size);
+        }
+
+        if (atomic_compare_exchange_strong_explicit(
+                &deque->top, &top, top + 1, memory_order_seq_cst,
+                memory_order_relaxed))
+        {
+            return SUCCESS;
+        }
+
+        // Lost the race to the owner or another thief; try the next one
+        cpu_relax();
+    }
+}
+
+size_t deque_ws_size(const deque_ws_t *deque)
+{
+    if (deque == NULL)
+    {
+        return 0;
+    }
+
+    // atomic_load does not accept const-qualified objects in C11
+    deque_ws_t *d = (deque_ws_t *)deque;
+    intptr_t top = atomic_load_explicit(&d->top, memory_order_acquire);
+    intptr_t bottom = atomic_load_explicit(&d->bottom, memory_order_acquire);
+
+    // A pop in progress can briefly leave bottom one below top
+    return bottom > top ? (size_t)(bottom - top) : 0;
+}
+
+bool deque_ws_empty(const deque_ws_t *deque)
+{
+    return deque_ws_size(deque) == 0;
 }
@@ -0,0 +1,923 @@
+/*
+ * @file pqueue.c
+ * @brief Implementation of Priority Queue Data Structure (Heap)
+ * @author Rodrigo Martins
+ * @version 0.0
+ * @date 2024
+ *
+ * CStructs+ Library - Priority Queue Module
+ * Provides d-ary heap priority queues stored in vectors
+ */
+
+#include "../../include/module 4/pqueue.h"
+#include <stdio.h>
+
+/* ===== HELPER FUNCTIONS ===== */
+
+/*
+ * @brief Gets the address of a heap slot
+ * @param pqueue Target priority queue
+ * @param index Slot index (may be past size for scratch space)
+ * @return Pointer to the slot
+ */
+static inline char *pqueue_at(const pqueue_t *pqueue, size_t index)
+{
+    return (char *)pqueue->vector->data +
+           index * pqueue->vector->element_size;
+}
+
+/*
+ * @brief Moves a hole up until value fits, then stores value there
+ * @param pqueue Target priority queue
+ * @param hole Index of the hole
+ * @param value Value being placed (must not live in slots 0..hole)
+ *
+ * @note Time complexity: O(log_d n)
+ * @note Each level costs one compare and one copy, not a three-copy swap
+ */
+static void pqueue_sift_up(pqueue_t *pqueue, size_t hole, const void *value)
+{
+    size_t width = pqueue->vector->element_size;
+
+    while (hole > 0)
+    {
+        size_t parent = (hole - 1) / pqueue->arity;
+        if (pqueue->cmp(value, pqueue_at(pqueue, parent)) >= 0)
+        {
+            break;
+        }
+
+        mem_copy(pqueue_at(pqueue, hole), pqueue_at(pqueue, parent), width);
+        hole = parent;
+    }
+
+    mem_copy(pqueue_at(pqueue, hole), value, width);
+}
+
+/*
+ * @brief Moves a hole down until value fits, then stores value there
+ * @param pqueue Target priority queue
+ * @param hole Index of the hole
+ * @param value Value being placed (must live at index >= size)
+ * @param size Number of slots in the heap
+ *
+ * @note Time complexity: O(d log_d n)
+ */
+static void pqueue_sift_down(pqueue_t *pqueue, size_t hole, const void *value,
+                             size_t size)
+{
+    size_t width = pqueue->vector->element_size;
+    size_t arity = pqueue->arity;
+
+    for (;;)
+    {
+        size_t first = hole * arity + 1;
+        if (first >= size)
+        {
+            break;
+        }
+
+        // Pick the lowest of up to d children
+        size_t last = size - first > arity ? first + arity : size;
+        size_t best = first;
+        for (size_t child = first + 1; child < last; child++)
+        {
+            if (pqueue->cmp(pqueue_at(pqueue, child),
+                            pqueue_at(pqueue, best)) < 0)
+            {
+                best = child;
+            }
+        }
+
+        if (pqueue->cmp(pqueue_at(pqueue, best), value) >= 0)
+        {
+            break;
+        }
+
+        mem_copy(pqueue_at(pqueue, hole), pqueue_at(pqueue, best), width);
+        hole = best;
+    }
+
+    mem_copy(pqueue_at(pqueue, hole), value, width);
+}
+
+/*
+ * @brief Restores heap order over the whole vector bottom-up
+ * @param pqueue Target priority queue
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(n)
+ * @note Uses the slot just past the end as scratch for the sifted value
+ */
+static status_t pqueue_build(pqueue_t *pqueue)
+{
+    size_t size = pqueue->vector->size;
+    if (size < 2)
+    {
+        return SUCCESS;
+    }
+
+    status_t result = vector_reserve(pqueue->vector, size + 1);
+    if (result != SUCCESS)
+    {
+        return result;
+    }
+
+    char *scratch = pqueue_at(pqueue, size);
+    size_t width = pqueue->vector->element_size;
+
+    for (size_t i = (size - 2) / pqueue->arity + 1; i-- > 0;)
+    {
+        mem_copy(scratch, pqueue_at(pqueue, i), width);
+        pqueue_sift_down(pqueue, i, scratch, size);
+    }
+
+    return SUCCESS;
+}
+
+/* ===== PRIORITY QUEUE IMPLEMENTATION ===== */
+
+pqueue_t *pqueue_create(size_t element_size, cmp_fn cmp)
+{
+    return pqueue_create_with_allocator(element_size, cmp,
+                                        PQUEUE_DEFAULT_ARITY, NULL);
+}
+
+pqueue_t *pqueue_create_with_arity(size_t element_size, cmp_fn cmp,
+                                   size_t arity)
+{
+    return pqueue_create_with_allocator(element_size, cmp, arity, NULL);
+}
+
+pqueue_t *pqueue_create_with_allocator(size_t element_size, cmp_fn cmp,
+                                       size_t arity,
+                                       const allocator_t *allocator)
+{
+    // Validate input parameters
+    if (element_size == 0 || cmp == NULL || arity < 2)
+    {
+        fprintf(stderr,
+                "Error: Invalid parameters for priority queue creation\n");
+        return NULL;
+    }
+
+    // Allocate priority queue structure
+    pqueue_t *pqueue =
+        (pqueue_t *)allocator_alloc(allocator, sizeof(pqueue_t));
+    if (pqueue == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate priority queue structure\n");
+        return NULL;
+    }
+
+    // Create underlying vector
+    pqueue->vector = vector_create_with_allocator(
+        element_size, VECTOR_INITIAL_CAPACITY, allocator);
+    if (pqueue->vector == NULL)
+    {
+        fprintf(stderr,
+                "Error: Failed to create underlying vector for priority "
+                "queue\n");
+        allocator_free(allocator, pqueue, sizeof(pqueue_t));
+        return NULL;
+    }
+
+    pqueue->cmp = cmp;
+    pqueue->arity = arity;
+
+    return pqueue;
+}
+
+void pqueue_destroy(pqueue_t *pqueue)
+{
+    if (pqueue != NULL)
+    {
+        // The structure came from the vector's allocator
+        allocator_t allocator = pqueue->vector->allocator;
+        vector_destroy(pqueue->vector);
+        allocator_free(&allocator, pqueue, sizeof(pqueue_t));
+    }
+}
+
+status_t pqueue_push(pqueue_t *pqueue, const void *element)
+{
+    // Validate input parameters
+    if (pqueue == NULL || element == NULL)
+    {
+        fprintf(stderr,
+                "Error: Invalid input parameters for priority queue push\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    // Grow by one slot, then sift the new hole up from the end
+    status_t result = vector_push_back(pqueue->vector, element);
+    if (result != SUCCESS)
+    {
+        return result;
+    }
+
+    pqueue_sift_up(pqueue, pqueue->vector->size - 1, element);
+
+    return SUCCESS;
+}
+
+status_t pqueue_push_bulk(pqueue_t *pqueue, const void *elements,
+                          size_t count)
+{
+    // Validate input parameters
+    if (pqueue == NULL || (elements == NULL && count > 0))
+    {
+        fprintf(stderr,
+                "Error: Invalid input parameters for priority queue "
+                "push_bulk\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (count == 0)
+    {
+        return SUCCESS;
+    }
+
+    vector_t *vector = pqueue->vector;
+    size_t old_size = vector->size;
+
+    // One extra slot serves as scratch for sift-up
+    status_t result = vector_reserve(vector, old_size + count + 1);
+    if (result != SUCCESS)
+    {
+        return result;
+    }
+
+    mem_copy(pqueue_at(pqueue, old_size), elements,
+             count * vector->element_size);
+    vector->size = old_size + count;
+
+    // A rebuild is O(n + count); sifting each is O(count log n)
+    if (count >= old_size)
+    {
+        return pqueue_build(pqueue);
+    }
+
+    char *scratch = pqueue_at(pqueue, vector->size);
+    for (size_t i = old_size; i < vector->size; i++)
+    {
+        mem_copy(scratch, pqueue_at(pqueue, i), vector->element_size);
+        pqueue_sift_up(pqueue, i, scratch);
+    }
+
+    return SUCCESS;
+}
+
+status_t pqueue_pop(pqueue_t *pqueue, void *output)
+{
+    // Validate input parameters
+    if (pqueue == NULL)
+    {
+        fprintf(stderr,
+                "Error: Invalid priority queue pointer for pop operation\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    size_t size = pqueue->vector->size;
+    if (size == 0)
+    {
+        return ERROR_EMPTY_CONTAINER;
+    }
+
+    if (output != NULL)
+    {
+        mem_copy(output, pqueue_at(pqueue, 0), pqueue->vector->element_size);
+    }
+
+    // The last element fills the hole left at the top
+    size--;
+    if (size > 0)
+    {
+        pqueue_sift_down(pqueue, 0, pqueue_at(pqueue, size), size);
+    }
+
+    return vector_pop_back(pqueue->vector, NULL);
+}
+
+status_t pqueue_peek(const pqueue_t *pqueue, void *output)
+{
+    // Validate input parameters
+    if (pqueue == NULL || output == NULL)
+    {
+        fprintf(stderr,
+                "Error: Invalid input parameters for priority queue peek\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (pqueue->vector->size == 0)
+    {
+        return ERROR_EMPTY_CONTAINER;
+    }
+
+    mem_copy(output, pqueue_at(pqueue, 0), pqueue->vector->element_size);
+    return SUCCESS;
+}
+
+const void *pqueue_peek_ref(const pqueue_t *pqueue)
+{
+    if (pqueue == NULL || pqueue->vector->size == 0)
+    {
+        return NULL;
+    }
+
+    return pqueue_at(pqueue, 0);
+}
+
+status_t pqueue_heapify(pqueue_t *pqueue, const void *elements, size_t count)
+{
+    // Validate input parameters
+    if (pqueue == NULL || (elements == NULL && count > 0))
+    {
+        fprintf(stderr,
+                "Error: Invalid input parameters for priority queue "
+                "heapify\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    vector_t *vector = pqueue->vector;
+    status_t result = vector_reserve(vector, count + 1);
+    if (result != SUCCESS)
+    {
+        return result;
+    }
+
+    if (count > 0)
+    {
+        mem_copy(vector->data, elements, count * vector->element_size);
+    }
+    vector->size = count;
+
+    return pqueue_build(pqueue);
+}
+
+void pqueue_clear(pqueue_t *pqueue)
+{
+    if (pqueue != NULL)
+    {
+        vector_clear(pqueue->vector);
+    }
+}
+
+status_t pqueue_reserve(pqueue_t *pqueue, size_t capacity)
+{
+    if (pqueue == NULL)
+    {
+        fprintf(stderr,
+                "Error: Invalid priority queue pointer for reserve "
+                "operation\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    return vector_reserve(pqueue->vector, capacity);
+}
+
+size_t pqueue_size(const pqueue_t *pqueue)
+{
+    return pqueue != NULL ? pqueue->vector->size : 0;
+}
+
+bool pqueue_empty(const pqueue_t *pqueue)
+{
+    return pqueue == NULL || pqueue->vector->size == 0;
+}
+
+/* ===== INDEXED PRIORITY QUEUE HELPERS ===== */
+
+/*
+ * @brief Gets the element stored under a handle
+ * @param pqueue Target priority queue
+ * @param handle Live or reserved handle
+ * @return Pointer to the element
+ */
+static inline char *pqueue_indexed_at(const pqueue_indexed_t *pqueue,
+                                      size_t handle)
+{
+    return (char *)pqueue->elements->data +
+           handle * pqueue->elements->element_size;
+}
+
+/*
+ * @brief Stores a handle in a heap slot and records the slot
+ * @param pqueue Target priority queue
+ * @param slot Heap slot
+ * @param handle Handle to place there
+ */
+static inline void pqueue_indexed_place(pqueue_indexed_t *pqueue,
+                                        size_t slot, size_t handle)
+{
+    ((size_t *)pqueue->heap->data)[slot] = handle;
+    ((size_t *)pqueue->positions->data)[handle] = slot;
+}
+
+/*
+ * @brief Moves a handle up from a heap slot until its element fits
+ * @param pqueue Target priority queue
+ * @param hole Heap slot the handle starts from
+ * @param handle Handle being placed
+ *
+ * @note Time complexity: O(log_d n)
+ */
+static void pqueue_indexed_sift_up(pqueue_indexed_t *pqueue, size_t hole,
+                                   size_t handle)
+{
+    const size_t *heap = (const size_t *)pqueue->heap->data;
+    const char *value = pqueue_indexed_at(pqueue, handle);
+
+    while (hole > 0)
+    {
+        size_t parent = (hole - 1) / pqueue->arity;
+        if (pqueue->cmp(value, pqueue_indexed_at(pqueue, heap[parent])) >= 0)
+        {
+            break;
+        }
+
+        pqueue_indexed_place(pqueue, hole, heap[parent]);
+        hole = parent;
+    }
+
+    pqueue_indexed_place(pqueue, hole, handle);
+}
+
+/*
+ * @brief Moves a handle down from a heap slot until its element fits
+ * @param pqueue Target priority queue
+ * @param hole Heap slot the handle starts from
+ * @param handle Handle being placed
+ *
+ * @note Time complexity: O(d log_d n)
+ */
+static void pqueue_indexed_sift_down(pqueue_indexed_t *pqueue, size_t hole,
+                                     size_t handle)
+{
+    const size_t *heap = (const size_t *)pqueue->heap->data;
+    const char *value = pqueue_indexed_at(pqueue, handle);
+    size_t size = pqueue->heap->size;
+    size_t arity = pqueue->arity;
+
+    for (;;)
+    {
+        size_t first = hole * arity + 1;
+        if (first >= size)
+        {
+            break;
+        }
+
+        // Pick the lowest of up to d children
+        size_t last = size - first > arity ? first + arity : size;
+        size_t best = first;
+        for (size_t child = first + 1; child < last; child++)
+        {
+            if (pqueue->cmp(pqueue_indexed_at(pqueue, heap[child]),
+                            pqueue_indexed_at(pqueue, heap[best])) < 0)
+            {
+                best = child;
+            }
+        }
+
+        if (pqueue->cmp(pqueue_indexed_at(pqueue, heap[best]), value) >= 0)
+        {
+            break;
+        }
+
+        pqueue_indexed_place(pqueue, hole, heap[best]);
+        hole = best;
+    }
+
+    pqueue_indexed_place(pqueue, hole, handle);
+}
+
+/*
+ * @brief Moves a handle whichever way restores heap order
+ * @param pqueue Target priority queue
+ * @param slot Heap slot the handle currently occupies
+ * @param handle Handle being placed
+ */
+static void pqueue_indexed_fix(pqueue_indexed_t *pqueue, size_t slot,
+                               size_t handle)
+{
+    const size_t *heap = (const size_t *)pqueue->heap->data;
+
+    if (slot > 0 &&
+        pqueue->cmp(pqueue_indexed_at(pqueue, handle),
+                    pqueue_indexed_at(pqueue,
+                                      heap[(slot - 1) / pqueue->arity])) < 0)
+    {
+        pqueue_indexed_sift_up(pqueue, slot, handle);
+    }
+    else
+    {
+        pqueue_indexed_sift_down(pqueue, slot, handle);
+    }
+}
+
+/*
+ * @brief Gets the heap slot of a handle
+ * @param pqueue Target priority queue
+ * @param handle Handle to look up
+ * @return Heap slot, PQUEUE_INVALID_HANDLE if the handle is not live
+ */
+static inline size_t pqueue_indexed_slot(const pqueue_indexed_t *pqueue,
+                                         size_t handle)
+{
+    if (handle >= pqueue->positions->size)
+    {
+        return PQUEUE_INVALID_HANDLE;
+    }
+
+    return ((const size_t *)pqueue->positions->data)[handle];
+}
+
+/*
+ * @brief Takes the element in a heap slot out of the queue
+ * @param pqueue Target priority queue
+ * @param slot Occupied heap slot
+ * @param output Where to store the element (can be NULL)
+ *
+ * @note Cannot fail: free_handles always has room for every handle
+ */
+static void pqueue_indexed_remove_at(pqueue_indexed_t *pqueue, size_t slot,
+                                     void *output)
+{
+    size_t *heap = (size_t *)pqueue->heap->data;
+    size_t handle = heap[slot];
+
+    if (output != NULL)
+    {
+        mem_copy(output, pqueue_indexed_at(pqueue, handle),
+                 pqueue->elements->element_size);
+    }
+
+    // The last handle fills the vacated slot
+    size_t last = heap[--pqueue->heap->size];
+    if (slot < pqueue->heap->size)
+    {
+        pqueue_indexed_fix(pqueue, slot, last);
+    }
+
+    ((size_t *)pqueue->positions->data)[handle] = PQUEUE_INVALID_HANDLE;
+    vector_push_back(pqueue->free_handles, &handle);
+}
+
+/* ===== INDEXED PRIORITY QUEUE IMPLEMENTATION ===== */
+
+pqueue_indexed_t *pqueue_indexed_create(size_t element_size, cmp_fn cmp)
+{
+    return pqueue_indexed_create_with_allocator(element_size, cmp,
+                                                PQUEUE_DEFAULT_ARITY, NULL);
+}
+
+pqueue_indexed_t *pqueue_indexed_create_with_allocator(
+    size_t element_size, cmp_fn cmp, size_t arity,
+    const allocator_t *allocator)
+{
+    // Validate input parameters
+    if (element_size == 0 || cmp == NULL || arity < 2)
+    {
+        fprintf(stderr, "Error: Invalid parameters for indexed priority "
+                        "queue creation\n");
+        return NULL;
+    }
+
+    pqueue_indexed_t *pqueue = (pqueue_indexed_t *)allocator_alloc(
+        allocator, sizeof(pqueue_indexed_t));
+    if (pqueue == NULL)
+    {
+        fprintf(stderr,
+                "Error: Failed to allocate indexed priority queue "
+                "structure\n");
+        return NULL;
+    }
+
+    pqueue->elements = vector_create_with_allocator(
+        element_size, VECTOR_INITIAL_CAPACITY, allocator);
+    pqueue->heap = vector_create_with_allocator(
+        sizeof(size_t), VECTOR_INITIAL_CAPACITY, allocator);
+    pqueue->positions = vector_create_with_allocator(
+        sizeof(size_t), VECTOR_INITIAL_CAPACITY, allocator);
+    pqueue->free_handles = vector_create_with_allocator(
+        sizeof(size_t), VECTOR_INITIAL_CAPACITY, allocator);
+    pqueue->cmp = cmp;
+    pqueue->arity = arity;
+
+    if (pqueue->elements == NULL || pqueue->heap == NULL ||
+        pqueue->positions == NULL || pqueue->free_handles == NULL)
+    {
+        fprintf(stderr,
+                "Error: Failed to create underlying vectors for indexed "
+                "priority queue\n");
+        vector_destroy(pqueue->elements);
+        vector_destroy(pqueue->heap);
+        vector_destroy(pqueue->positions);
+        vector_destroy(pqueue->free_handles);
+        allocator_free(allocator, pqueue, sizeof(pqueue_indexed_t));
+        return NULL;
+    }
+
+    return pqueue;
+}
+
+void pqueue_indexed_destroy(pqueue_indexed_t *pqueue)
+{
+    if (pqueue != NULL)
+    {
+        // The structure came from the vectors' allocator
+        allocator_t allocator = pqueue->heap->allocator;
+        vector_destroy(pqueue->elements);
+        vector_destroy(pqueue->heap);
+        vector_destroy(pqueue->positions);
+        vector_destroy(pqueue->free_handles);
+        allocator_free(&allocator, pqueue, sizeof(pqueue_indexed_t));
+    }
+}
+
+status_t pqueue_indexed_push(pqueue_indexed_t *pqueue, const void *element,
+                             size_t *handle)
+{
+    // Validate input parameters
+    if (pqueue == NULL || element == NULL)
+    {
+        fprintf(stderr, "Error: Invalid input parameters for indexed "
+                        "priority queue push\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    vector_t *free_handles = pqueue->free_handles;
+    bool reused = free_handles->size > 0;
+    size_t id;
+    status_t result;
+
+    if (reused)
+    {
+        id = ((const size_t *)free_handles->data)[free_handles->size - 1];
+    }
+    else
+    {
+        // A new handle needs an element slot and a position entry
+        id = pqueue->elements->size;
+        result = vector_push_back(pqueue->elements, element);
+        if (result != SUCCESS)
+        {
+            return result;
+        }
+
+        size_t unplaced = PQUEUE_INVALID_HANDLE;
+        result = vector_push_back(pqueue->positions, &unplaced);
+        if (result == SUCCESS)
+        {
+            // Keep room to release every handle without allocating
+            result = vector_reserve(free_handles,
+                                    pqueue->positions->capacity);
+        }
+        if (result != SUCCESS)
+        {
+            pqueue->elements->size = id;
+            pqueue->positions->size = id;
+            return result;
+        }
+    }
+
+    result = vector_push_back(pqueue->heap, &id);
+    if (result != SUCCESS)
+    {
+        if (!reused)
+        {
+            pqueue->elements->size = id;
+            pqueue->positions->size = id;
+        }
+        return result;
+    }
+
+    if (reused)
+    {
+        mem_copy(pqueue_indexed_at(pqueue, id), element,
+                 pqueue->elements->element_size);
+        free_handles->size--;
+    }
+
+    pqueue_indexed_sift_up(pqueue, pqueue->heap->size - 1, id);
+
+    if (handle != NULL)
+    {
+        *handle = id;
+    }
+
+    return SUCCESS;
+}
+
+status_t pqueue_indexed_pop(pqueue_indexed_t *pqueue, void *output,
+                            size_t *handle)
+{
+    // Validate input parameters
+    if (pqueue == NULL)
+    {
+        fprintf(stderr, "Error: Invalid indexed priority queue pointer for "
+                        "pop operation\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (pqueue->heap->size == 0)
+    {
+        return ERROR_EMPTY_CONTAINER;
+    }
+
+    if (handle != NULL)
+    {
+        *handle = ((const size_t *)pqueue->heap->data)[0];
+    }
+
+    pqueue_indexed_remove_at(pqueue, 0, output);
+
+    return SUCCESS;
+}
+
+status_t pqueue_indexed_peek(const pqueue_indexed_t *pqueue, void *output,
+                             size_t *handle)
+{
+    // Validate input parameters
+    if (pqueue == NULL)
+    {
+        fprintf(stderr, "Error: Invalid indexed priority queue pointer for "
+                        "peek operation\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (pqueue->heap->size == 0)
+    {
+        return ERROR_EMPTY_CONTAINER;
+    }
+
+    size_t top = ((const size_t *)pqueue->heap->data)[0];
+    if (output != NULL)
+    {
+        mem_copy(output, pqueue_indexed_at(pqueue, top),
+                 pqueue->elements->element_size);
+    }
+    if (handle != NULL)
+    {
+        *handle = top;
+    }
+
+    return SUCCESS;
+}
+
+status_t pqueue_indexed_get(const pqueue_indexed_t *pqueue, size_t handle,
+                            void *output)
+{
+    // Validate input parameters
+    if (pqueue == NULL || output == NULL)
+    {
+        fprintf(stderr, "Error: Invalid input parameters for indexed "
+                        "priority queue get\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (pqueue_indexed_slot(pqueue, handle) == PQUEUE_INVALID_HANDLE)
+    {
+        return ERROR_NOT_FOUND;
+    }
+
+    mem_copy(output, pqueue_indexed_at(pqueue, handle),
+             pqueue->elements->element_size);
+
+    return SUCCESS;
+}
+
+bool pqueue_indexed_contains(const pqueue_indexed_t *pqueue, size_t handle)
+{
+    return pqueue != NULL &&
+           pqueue_indexed_slot(pqueue, handle) != PQUEUE_INVALID_HANDLE;
+}
+
+status_t pqueue_indexed_decrease_key(pqueue_indexed_t *pqueue, size_t handle,
+                                     const void *element)
+{
+    // Validate input parameters
+    if (pqueue == NULL || element == NULL)
+    {
+        fprintf(stderr, "Error: Invalid input parameters for indexed "
+                        "priority queue decrease_key\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    size_t slot = pqueue_indexed_slot(pqueue, handle);
+    if (slot == PQUEUE_INVALID_HANDLE)
+    {
+        return ERROR_NOT_FOUND;
+    }
+
+    if (pqueue->cmp(element, pqueue_indexed_at(pqueue, handle)) > 0)
+    {
+        fprintf(stderr,
+                "Error: decrease_key given a value that orders later\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    mem_copy(pqueue_indexed_at(pqueue, handle), element,
+             pqueue->elements->element_size);
+    pqueue_indexed_sift_up(pqueue, slot, handle);
+
+    return SUCCESS;
+}
+
+status_t pqueue_indexed_increase_key(pqueue_indexed_t *pqueue, size_t handle,
+                                     const void *element)
+{
+    // Validate input parameters
+    if (pqueue == NULL || element == NULL)
+    {
+        fprintf(stderr, "Error: Invalid input parameters for indexed "
+                        "priority queue increase_key\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    size_t slot = pqueue_indexed_slot(pqueue, handle);
+    if (slot == PQUEUE_INVALID_HANDLE)
+    {
+        return ERROR_NOT_FOUND;
+    }
+
+    if (pqueue->cmp(element, pqueue_indexed_at(pqueue, handle)) < 0)
+    {
+        fprintf(stderr,
+                "Error: increase_key given a value that orders earlier\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    mem_copy(pqueue_indexed_at(pqueue, handle), element,
+             pqueue->elements->element_size);
+    pqueue_indexed_sift_down(pqueue, slot, handle);
+
+    return SUCCESS;
+}
+
+status_t pqueue_indexed_update(pqueue_indexed_t *pqueue, size_t handle,
+                               const void *element)
+{
+    // Validate input parameters
+    if (pqueue == NULL || element == NULL)
+    {
+        fprintf(stderr, "Error: Invalid input parameters for indexed "
+                        "priority queue update\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    size_t slot = pqueue_indexed_slot(pqueue, handle);
+    if (slot == PQUEUE_INVALID_HANDLE)
+    {
+        return ERROR_NOT_FOUND;
+    }
+
+    mem_copy(pqueue_indexed_at(pqueue, handle), element,
+             pqueue->elements->element_size);
+    pqueue_indexed_fix(pqueue, slot, handle);
+
+    return SUCCESS;
+}
+
+status_t pqueue_indexed_remove(pqueue_indexed_t *pqueue, size_t handle,
+                               void *output)
+{
+    // Validate input parameters
+    if (pqueue == NULL)
+    {
+        fprintf(stderr, "Error: Invalid indexed priority queue pointer for "
+                        "remove operation\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    size_t slot = pqueue_indexed_slot(pqueue, handle);
+    if (slot == PQUEUE_INVALID_HANDLE)
+    {
+        return ERROR_NOT_FOUND;
+    }
+
+    pqueue_indexed_remove_at(pqueue, slot, output);
+
+    return SUCCESS;
+}
+
+void pqueue_indexed_clear(pqueue_indexed_t *pqueue)
+{
+    if (pqueue != NULL)
+    {
+        vector_clear(pqueue->elements);
+        vector_clear(pqueue->heap);
+        vector_clear(pqueue->positions);
+        vector_clear(pqueue->free_handles);
+    }
+}
+
+size_t pqueue_indexed_size(const pqueue_indexed_t *pqueue)
+{
+    return pqueue != NULL ? pqueue->heap->size : 0;
+}
+
+bool pqueue_indexed_empty(const pqueue_indexed_t *pqueue)
+{
+    return pqueue == NULL || pqueue->heap->size == 0;
+}
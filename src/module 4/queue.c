@@ -17,6 +17,12 @@
 #define QUEUE_INITIAL_CAPACITY 16
 #define QUEUE_GROWTH_FACTOR 2
 
+// Element offset inside an MPMC cell; keeps the payload malloc-aligned
+#define QUEUE_MPMC_DATA_OFFSET _Alignof(max_align_t)
+
+// Pause iterations before a blocking MPMC call starts yielding the CPU
+#define QUEUE_MPMC_SPIN_LIMIT 64
+
 /* ===== ARRAY QUEUE IMPLEMENTATION ===== */
 
 /*
@@ -38,7 +44,8 @@ static status_t queue_array_resize(queue_array_t *queue, size_t new_capacity)
     }
 
     // Allocate new data array
-    void *new_data = mem_alloc(new_capacity * queue->element_size);
+    void *new_data =
+        allocator_alloc(&queue->allocator, new_capacity * queue->element_size);
     if (new_data == NULL)
     {
         fprintf(stderr,
@@ -78,7 +85,8 @@ static status_t queue_array_resize(queue_array_t *queue, size_t new_capacity)
     }
 
     // Update queue state with new array
-    mem_free(&queue->data);
+    allocator_free(&queue->allocator, queue->data,
+                   queue->capacity * queue->element_size);
     queue->data = new_data;
     queue->capacity = new_capacity;
     queue->front = 0;
@@ -117,6 +125,13 @@ queue_array_t *queue_array_create(size_t element_size)
 
 queue_array_t *queue_array_create_with_capacity(size_t element_size,
                                                 size_t capacity)
+{
+    return queue_array_create_with_allocator(element_size, capacity, NULL);
+}
+
+queue_array_t *queue_array_create_with_allocator(size_t element_size,
+                                                 size_t capacity,
+                                                 const allocator_t *allocator)
 {
     // Validate input parameters
     if (element_size == 0)
@@ -130,8 +145,14 @@ queue_array_t *queue_array_create_with_capacity(size_t element_size,
         capacity = QUEUE_INITIAL_CAPACITY;
     }
 
+    if (allocator == NULL)
+    {
+        allocator = allocator_default();
+    }
+
     // Allocate queue structure
-    queue_array_t *queue = (queue_array_t *)mem_alloc(sizeof(queue_array_t));
+    queue_array_t *queue =
+        (queue_array_t *)allocator_alloc(allocator, sizeof(queue_array_t));
     if (queue == NULL)
     {
         fprintf(stderr, "Error: Failed to allocate queue structure\n");
@@ -139,12 +160,12 @@ queue_array_t *queue_array_create_with_capacity(size_t element_size,
     }
 
     // Allocate data array
-    queue->data = mem_alloc(capacity * element_size);
+    queue->data = allocator_alloc(allocator, capacity * element_size);
     if (queue->data == NULL)
     {
         fprintf(stderr, "Error: Failed to allocate queue data of size %zu\n",
                 capacity * element_size);
-        mem_free((void **)&queue);
+        allocator_free(allocator, queue, sizeof(queue_array_t));
         return NULL;
     }
 
@@ -154,6 +175,7 @@ queue_array_t *queue_array_create_with_capacity(size_t element_size,
     queue->size = 0;
     queue->capacity = capacity;
     queue->element_size = element_size;
+    queue->allocator = *allocator;
 
     return queue;
 }
@@ -162,8 +184,11 @@ void queue_array_destroy(queue_array_t *queue)
 {
     if (queue != NULL)
     {
-        mem_free(&queue->data);
-        mem_free((void **)&queue);
+        // Copy the allocator out: it lives inside the block being freed
+        allocator_t allocator = queue->allocator;
+        allocator_free(&allocator, queue->data,
+                       queue->capacity * queue->element_size);
+        allocator_free(&allocator, queue, sizeof(queue_array_t));
     }
 }
 
@@ -291,6 +316,12 @@ status_t queue_array_reserve(queue_array_t *queue, size_t capacity)
 /* ===== LINKED LIST QUEUE IMPLEMENTATION ===== */
 
 queue_list_t *queue_list_create(size_t element_size)
+{
+    return queue_list_create_with_allocator(element_size, NULL);
+}
+
+queue_list_t *queue_list_create_with_allocator(size_t element_size,
+                                               const allocator_t *allocator)
 {
     // Validate input parameters
     if (element_size == 0)
@@ -300,7 +331,8 @@ queue_list_t *queue_list_create(size_t element_size)
     }
 
     // Allocate queue structure
-    queue_list_t *queue = (queue_list_t *)mem_alloc(sizeof(queue_list_t));
+    queue_list_t *queue =
+        (queue_list_t *)allocator_alloc(allocator, sizeof(queue_list_t));
     if (queue == NULL)
     {
         fprintf(stderr, "Error: Failed to allocate queue structure\n");
@@ -308,11 +340,11 @@ queue_list_t *queue_list_create(size_t element_size)
     }
 
     // Create underlying linked list
-    queue->list = singly_list_create(element_size);
+    queue->list = singly_list_create_with_allocator(element_size, allocator);
     if (queue->list == NULL)
     {
         fprintf(stderr, "Error: Failed to create underlying list for queue\n");
-        mem_free((void **)&queue);
+        allocator_free(allocator, queue, sizeof(queue_list_t));
         return NULL;
     }
 
@@ -323,8 +355,10 @@ void queue_list_destroy(queue_list_t *queue)
 {
     if (queue != NULL)
     {
+        // The queue structure came from the list's allocator
+        allocator_t allocator = queue->list->allocator;
         singly_list_destroy(queue->list);
-        mem_free((void **)&queue);
+        allocator_free(&allocator, queue, sizeof(queue_list_t));
     }
 }
 
@@ -379,3 +413,598 @@ bool queue_list_empty(const queue_list_t *queue)
 {
     return queue == NULL || singly_list_empty(queue->list);
 }
+
+/* ===== SPSC QUEUE IMPLEMENTATION ===== */
+
+queue_spsc_t *queue_spsc_create(size_t element_size, size_t capacity)
+{
+    return queue_spsc_create_with_allocator(element_size, capacity, NULL);
+}
+
+queue_spsc_t *queue_spsc_create_with_allocator(size_t element_size,
+                                               size_t capacity,
+                                               const allocator_t *allocator)
+{
+    // Validate input parameters
+    if (element_size == 0)
+    {
+        fprintf(stderr, "Error: Cannot create queue with element size 0\n");
+        return NULL;
+    }
+
+    if (capacity == 0)
+    {
+        capacity = QUEUE_INITIAL_CAPACITY;
+    }
+
+    capacity = next_power_of_two(capacity);
+    if (capacity == 0)
+    {
+        fprintf(stderr, "Error: SPSC queue capacity too large\n");
+        return NULL;
+    }
+
+    if (allocator == NULL)
+    {
+        allocator = allocator_default();
+    }
+
+    // Allocate queue structure
+    queue_spsc_t *queue =
+        (queue_spsc_t *)allocator_alloc(allocator, sizeof(queue_spsc_t));
+    if (queue == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate queue structure\n");
+        return NULL;
+    }
+
+    // Allocate slot array
+    queue->data = allocator_alloc(allocator, capacity * element_size);
+    if (queue->data == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate queue data of size %zu\n",
+                capacity * element_size);
+        allocator_free(allocator, queue, sizeof(queue_spsc_t));
+        return NULL;
+    }
+
+    // Initialize queue state
+    queue->mask = capacity - 1;
+    queue->element_size = element_size;
+    queue->allocator = *allocator;
+    atomic_init(&queue->tail, 0);
+    queue->cached_head = 0;
+    atomic_init(&queue->head, 0);
+    queue->cached_tail = 0;
+
+    return queue;
+}
+
+void queue_spsc_destroy(queue_spsc_t *queue)
+{
+    if (queue != NULL)
+    {
+        // Copy the allocator out: it lives inside the block being freed
+        allocator_t allocator = queue->allocator;
+        allocator_free(&allocator, queue->data,
+                       (queue->mask + 1) * queue->element_size);
+        allocator_free(&allocator, queue, sizeof(queue_spsc_t));
+    }
+}
+
+/*
+ * @brief Counts free slots as seen by the producer
+ * @param queue Target queue
+ * @param tail Producer's current tail
+ * @param wanted Number of slots the caller needs
+ * @return Number of free slots
+ *
+ * @note Only reloads head (a cross-core read) when the cached value does not
+ * already show enough room
+ */
+static inline size_t queue_spsc_free_slots(queue_spsc_t *queue, size_t tail,
+                                           size_t wanted)
+{
+    size_t capacity = queue->mask + 1;
+    size_t free_slots = capacity - (tail - queue->cached_head);
+    if (free_slots < wanted)
+    {
+        // Acquire pairs with the consumer's release of emptied slots
+        queue->cached_head =
+            atomic_load_explicit(&queue->head, memory_order_acquire);
+        free_slots = capacity - (tail - queue->cached_head);
+    }
+    return free_slots;
+}
+
+/*
+ * @brief Counts queued elements as seen by the consumer
+ * @param queue Target queue
+ * @param head Consumer's current head
+ * @param wanted Number of elements the caller needs
+ * @return Number of readable elements
+ *
+ * @note Only reloads tail (a cross-core read) when the cached value does not
+ * already show enough elements
+ */
+static inline size_t queue_spsc_used_slots(queue_spsc_t *queue, size_t head,
+                                           size_t wanted)
+{
+    size_t used = queue->cached_tail - head;
+    if (used < wanted)
+    {
+        // Acquire pairs with the producer's release of filled slots
+        queue->cached_tail =
+            atomic_load_explicit(&queue->tail, memory_order_acquire);
+        used = queue->cached_tail - head;
+    }
+    return used;
+}
+
+status_t queue_spsc_try_enqueue(queue_spsc_t *queue, const void *element)
+{
+    // Validate input parameters
+    if (queue == NULL || element == NULL)
+    {
+        fprintf(stderr, "Error: Invalid input parameters for queue enqueue\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    // tail is only written by this thread, so a relaxed load is exact
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    if (queue_spsc_free_slots(queue, tail, 1) == 0)
+    {
+        return ERROR_FULL_CONTAINER;
+    }
+
+    void *dest =
+        (char *)queue->data + ((tail & queue->mask) * queue->element_size);
+    mem_copy(dest, element, queue->element_size);
+
+    // Release makes the element visible before the new tail
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+
+    return SUCCESS;
+}
+
+status_t queue_spsc_try_dequeue(queue_spsc_t *queue, void *output)
+{
+    // Validate input parameters
+    if (queue == NULL)
+    {
+        fprintf(stderr, "Error: Invalid queue pointer for dequeue operation\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    // head is only written by this thread, so a relaxed load is exact
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    if (queue_spsc_used_slots(queue, head, 1) == 0)
+    {
+        return ERROR_EMPTY_CONTAINER;
+    }
+
+    if (output != NULL)
+    {
+        void *src =
+            (char *)queue->data + ((head & queue->mask) * queue->element_size);
+        mem_copy(output, src, queue->element_size);
+    }
+
+    // Release hands the slot back only after it has been read
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+
+    return SUCCESS;
+}
+
+void *queue_spsc_reserve(queue_spsc_t *queue, size_t max_count, size_t *count)
+{
+    // Validate input parameters
+    if (queue == NULL || count == NULL)
+    {
+        fprintf(stderr, "Error: Invalid input parameters for queue reserve\n");
+        return NULL;
+    }
+
+    *count = 0;
+    if (max_count == 0)
+    {
+        return NULL;
+    }
+
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    size_t available = queue_spsc_free_slots(queue, tail, max_count);
+    if (available == 0)
+    {
+        return NULL;
+    }
+
+    // Stop at the end of the array so the span stays contiguous
+    size_t slot = tail & queue->mask;
+    size_t contiguous = queue->mask + 1 - slot;
+    if (available > contiguous)
+    {
+        available = contiguous;
+    }
+    *count = available < max_count ? available : max_count;
+
+    return (char *)queue->data + (slot * queue->element_size);
+}
+
+status_t queue_spsc_commit(queue_spsc_t *queue, size_t count)
+{
+    if (queue == NULL)
+    {
+        fprintf(stderr, "Error: Invalid queue pointer for commit operation\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    if (count > queue->mask + 1 - (tail - queue->cached_head))
+    {
+        fprintf(stderr, "Error: Cannot commit more slots than reserved\n");
+        return ERROR_FULL_CONTAINER;
+    }
+
+    atomic_store_explicit(&queue->tail, tail + count, memory_order_release);
+
+    return SUCCESS;
+}
+
+void *queue_spsc_acquire(queue_spsc_t *queue, size_t max_count, size_t *count)
+{
+    // Validate input parameters
+    if (queue == NULL || count == NULL)
+    {
+        fprintf(stderr, "Error: Invalid input parameters for queue acquire\n");
+        return NULL;
+    }
+
+    *count = 0;
+    if (max_count == 0)
+    {
+        return NULL;
+    }
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    size_t available = queue_spsc_used_slots(queue, head, max_count);
+    if (available == 0)
+    {
+        return NULL;
+    }
+
+    // Stop at the end of the array so the span stays contiguous
+    size_t slot = head & queue->mask;
+    size_t contiguous = queue->mask + 1 - slot;
+    if (available > contiguous)
+    {
+        available = contiguous;
+    }
+    *count = available < max_count ? available : max_count;
+
+    return (char *)queue->data + (slot * queue->element_size);
+}
+
+status_t queue_spsc_release(queue_spsc_t *queue, size_t count)
+{
+    if (queue == NULL)
+    {
+        fprintf(stderr, "Error: Invalid queue pointer for release operation\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    if (count > queue->cached_tail - head)
+    {
+        fprintf(stderr, "Error: Cannot release more slots than acquired\n");
+        return ERROR_EMPTY_CONTAINER;
+    }
+
+    atomic_store_explicit(&queue->head, head + count, memory_order_release);
+
+    return SUCCESS;
+}
+
+size_t queue_spsc_size(const queue_spsc_t *queue)
+{
+    if (queue == NULL)
+    {
+        return 0;
+    }
+
+    // atomic_load does not accept const-qualified objects in C11
+    queue_spsc_t *q = (queue_spsc_t *)queue;
+    size_t head = atomic_load_explicit(&q->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+
+    // head was read first, so a racing producer can push the difference past
+    // the capacity; clamp it
+    size_t used = tail - head;
+    return used <= q->mask ? used : q->mask + 1;
+}
+
+bool queue_spsc_empty(const queue_spsc_t *queue)
+{
+    return queue_spsc_size(queue) == 0;
+}
+
+size_t queue_spsc_capacity(const queue_spsc_t *queue)
+{
+    return queue != NULL ? queue->mask + 1 : 0;
+}
+
+/* ===== MPMC QUEUE IMPLEMENTATION ===== */
+
+/*
+ * @brief Gets the sequence counter of the cell at a position
+ * @param queue Target queue
+ * @param pos Free-running position (wrapped with the mask)
+ * @return Pointer to the cell's sequence counter
+ */
+static inline atomic_size_t *queue_mpmc_cell(const queue_mpmc_t *queue,
+                                             size_t pos)
+{
+    return (atomic_size_t *)(queue->cells + (pos & queue->mask) *
+                                                queue->cell_size);
+}
+
+queue_mpmc_t *queue_mpmc_create(size_t element_size, size_t capacity)
+{
+    return queue_mpmc_create_with_allocator(element_size, capacity, NULL);
+}
+
+queue_mpmc_t *queue_mpmc_create_with_allocator(size_t element_size,
+                                               size_t capacity,
+                                               const allocator_t *allocator)
+{
+    // Validate input parameters
+    if (element_size == 0)
+    {
+        fprintf(stderr, "Error: Cannot create queue with element size 0\n");
+        return NULL;
+    }
+
+    if (capacity == 0)
+    {
+        capacity = QUEUE_INITIAL_CAPACITY;
+    }
+
+    // A single cell could never tell "free" from "full" apart
+    capacity = next_power_of_two(capacity < 2 ? 2 : capacity);
+    if (capacity == 0)
+    {
+        fprintf(stderr, "Error: MPMC queue capacity too large\n");
+        return NULL;
+    }
+
+    if (allocator == NULL)
+    {
+        allocator = allocator_default();
+    }
+
+    // Allocate queue structure
+    queue_mpmc_t *queue =
+        (queue_mpmc_t *)allocator_alloc(allocator, sizeof(queue_mpmc_t));
+    if (queue == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate queue structure\n");
+        return NULL;
+    }
+
+    // Cells are rounded so every sequence counter stays aligned
+    size_t align = QUEUE_MPMC_DATA_OFFSET;
+    size_t cell_size =
+        (QUEUE_MPMC_DATA_OFFSET + element_size + align - 1) & ~(align - 1);
+
+    queue->cells =
+        (unsigned char *)allocator_alloc(allocator, capacity * cell_size);
+    if (queue->cells == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate queue data of size %zu\n",
+                capacity * cell_size);
+        allocator_free(allocator, queue, sizeof(queue_mpmc_t));
+        return NULL;
+    }
+
+    // Initialize queue state
+    queue->mask = capacity - 1;
+    queue->element_size = element_size;
+    queue->cell_size = cell_size;
+    queue->allocator = *allocator;
+    atomic_init(&queue->enqueue_pos, 0);
+    atomic_init(&queue->dequeue_pos, 0);
+
+    // Cell i is free for the producer that claims position i
+    for (size_t i = 0; i < capacity; i++)
+    {
+        atomic_init(queue_mpmc_cell(queue, i), i);
+    }
+
+    return queue;
+}
+
+void queue_mpmc_destroy(queue_mpmc_t *queue)
+{
+    if (queue != NULL)
+    {
+        // Copy the allocator out: it lives inside the block being freed
+        allocator_t allocator = queue->allocator;
+        allocator_free(&allocator, queue->cells,
+                       (queue->mask + 1) * queue->cell_size);
+        allocator_free(&allocator, queue, sizeof(queue_mpmc_t));
+    }
+}
+
+status_t queue_mpmc_try_enqueue(queue_mpmc_t *queue, const void *element)
+{
+    // Validate input parameters
+    if (queue == NULL || element == NULL)
+    {
+        fprintf(stderr, "Error: Invalid input parameters for queue enqueue\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    size_t pos =
+        atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+    atomic_size_t *cell;
+
+    for (;;)
+    {
+        cell = queue_mpmc_cell(queue, pos);
+        size_t seq = atomic_load_explicit(cell, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0)
+        {
+            // Cell is free at our position: try to claim it
+            if (atomic_compare_exchange_weak_explicit(
+                    &queue->enqueue_pos, &pos, pos + 1, memory_order_relaxed,
+                    memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Cell still holds the element from one lap ago
+            return ERROR_FULL_CONTAINER;
+        }
+        else
+        {
+            // Another producer claimed this position; catch up
+            pos = atomic_load_explicit(&queue->enqueue_pos,
+                                       memory_order_relaxed);
+        }
+    }
+
+    mem_copy((unsigned char *)cell + QUEUE_MPMC_DATA_OFFSET, element,
+             queue->element_size);
+
+    // Release publishes the element to the consumer that claims pos
+    atomic_store_explicit(cell, pos + 1, memory_order_release);
+
+    return SUCCESS;
+}
+
+status_t queue_mpmc_try_dequeue(queue_mpmc_t *queue, void *output)
+{
+    // Validate input parameters
+    if (queue == NULL)
+    {
+        fprintf(stderr, "Error: Invalid queue pointer for dequeue operation\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    size_t pos =
+        atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+    atomic_size_t *cell;
+
+    for (;;)
+    {
+        cell = queue_mpmc_cell(queue, pos);
+        size_t seq = atomic_load_explicit(cell, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+        if (diff == 0)
+        {
+            // Cell is full at our position: try to claim it
+            if (atomic_compare_exchange_weak_explicit(
+                    &queue->dequeue_pos, &pos, pos + 1, memory_order_relaxed,
+                    memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // No producer has filled this position yet
+            return ERROR_EMPTY_CONTAINER;
+        }
+        else
+        {
+            // Another consumer claimed this position; catch up
+            pos = atomic_load_explicit(&queue->dequeue_pos,
+                                       memory_order_relaxed);
+        }
+    }
+
+    if (output != NULL)
+    {
+        mem_copy(output, (unsigned char *)cell + QUEUE_MPMC_DATA_OFFSET,
+                 queue->element_size);
+    }
+
+    // Mark the cell free for the producer one lap ahead
+    atomic_store_explicit(cell, pos + queue->mask + 1, memory_order_release);
+
+    return SUCCESS;
+}
+
+status_t queue_mpmc_enqueue(queue_mpmc_t *queue, const void *element)
+{
+    size_t spins = 0;
+    status_t result;
+
+    while ((result = queue_mpmc_try_enqueue(queue, element)) ==
+           ERROR_FULL_CONTAINER)
+    {
+        if (++spins < QUEUE_MPMC_SPIN_LIMIT)
+        {
+            cpu_relax();
+        }
+        else
+        {
+            thread_yield();
+        }
+    }
+
+    return result;
+}
+
+status_t queue_mpmc_dequeue(queue_mpmc_t *queue, void *output)
+{
+    size_t spins = 0;
+    status_t result;
+
+    while ((result = queue_mpmc_try_dequeue(queue, output)) ==
+           ERROR_EMPTY_CONTAINER)
+    {
+        if (++spins < QUEUE_MPMC_SPIN_LIMIT)
+        {
+            cpu_relax();
+        }
+        else
+        {
+            thread_yield();
+        }
+    }
+
+    return result;
+}
+
+size_t queue_mpmc_size(const queue_mpmc_t *queue)
+{
+    if (queue == NULL)
+    {
+        return 0;
+    }
+
+    // atomic_load does not accept const-qualified objects in C11
+    queue_mpmc_t *q = (queue_mpmc_t *)queue;
+    size_t head = atomic_load_explicit(&q->dequeue_pos, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&q->enqueue_pos, memory_order_acquire);
+
+    // Claimed-but-unfinished cells are counted, and producers racing past
+    // the head we read can push the difference over the capacity; clamp it
+    size_t used = tail - head;
+    return used <= q->mask ? used : q->mask + 1;
+}
+
+bool queue_mpmc_empty(const queue_mpmc_t *queue)
+{
+    return queue_mpmc_size(queue) == 0;
+}
+
+size_t queue_mpmc_capacity(const queue_mpmc_t *queue)
+{
+    return queue != NULL ? queue->mask + 1 : 0;
+}
@@ -6,12 +6,22 @@
  * @date 2024
  *
  * CStructs+ Library - Stack Module
- * Provides stack implementation using both arrays and linked lists
+ * Provides stack implementation using both arrays and linked lists, plus a
+ * lock-free Treiber stack for sharing between threads
  */
 
 #include "../../include/module 4/stack.h"
 #include <stdio.h>
 
+/* ===== CONSTANTS ===== */
+
+// Element offset inside a lock-free node; keeps the payload malloc-aligned
+#define STACK_LOCKFREE_DATA_OFFSET _Alignof(max_align_t)
+
+// Total nodes the chunk table can address
+#define STACK_LOCKFREE_MAX_NODES                                               \
+    ((size_t)STACK_LOCKFREE_FIRST_CHUNK << (STACK_LOCKFREE_MAX_CHUNKS - 1))
+
 /* ===== ARRAY STACK IMPLEMENTATION ===== */
 
 stack_array_t *stack_array_create(size_t element_size)
@@ -22,6 +32,13 @@ stack_array_t *stack_array_create(size_t element_size)
 
 stack_array_t *stack_array_create_with_capacity(size_t element_size,
                                                 size_t capacity)
+{
+    return stack_array_create_with_allocator(element_size, capacity, NULL);
+}
+
+stack_array_t *stack_array_create_with_allocator(size_t element_size,
+                                                 size_t capacity,
+                                                 const allocator_t *allocator)
 {
     // Validate input parameters
     if (element_size == 0)
@@ -31,7 +48,8 @@ stack_array_t *stack_array_create_with_capacity(size_t element_size,
     }
 
     // Allocate stack structure
-    stack_array_t *stack = (stack_array_t *)mem_alloc(sizeof(stack_array_t));
+    stack_array_t *stack =
+        (stack_array_t *)allocator_alloc(allocator, sizeof(stack_array_t));
     if (stack == NULL)
     {
         fprintf(stderr, "Error: Failed to allocate stack structure\n");
@@ -39,12 +57,13 @@ stack_array_t *stack_array_create_with_capacity(size_t element_size,
     }
 
     // Create underlying vector with specified capacity
-    stack->vector = vector_create_with_capacity(element_size, capacity);
+    stack->vector =
+        vector_create_with_allocator(element_size, capacity, allocator);
     if (stack->vector == NULL)
     {
         fprintf(stderr,
                 "Error: Failed to create underlying vector for stack\n");
-        mem_free((void **)&stack);
+        allocator_free(allocator, stack, sizeof(stack_array_t));
         return NULL;
     }
 
@@ -55,8 +74,10 @@ void stack_array_destroy(stack_array_t *stack)
 {
     if (stack != NULL)
     {
+        // The stack structure came from the vector's allocator
+        allocator_t allocator = stack->vector->allocator;
         vector_destroy(stack->vector);
-        mem_free((void **)&stack);
+        allocator_free(&allocator, stack, sizeof(stack_array_t));
     }
 }
 
@@ -145,6 +166,12 @@ status_t stack_array_reserve(stack_array_t *stack, size_t capacity)
 /* ===== LINKED LIST STACK IMPLEMENTATION ===== */
 
 stack_list_t *stack_list_create(size_t element_size)
+{
+    return stack_list_create_with_allocator(element_size, NULL);
+}
+
+stack_list_t *stack_list_create_with_allocator(size_t element_size,
+                                               const allocator_t *allocator)
 {
     // Validate input parameters
     if (element_size == 0)
@@ -154,7 +181,8 @@ stack_list_t *stack_list_create(size_t element_size)
     }
 
     // Allocate stack structure
-    stack_list_t *stack = (stack_list_t *)mem_alloc(sizeof(stack_list_t));
+    stack_list_t *stack =
+        (stack_list_t *)allocator_alloc(allocator, sizeof(stack_list_t));
     if (stack == NULL)
     {
         fprintf(stderr, "Error: Failed to allocate stack structure\n");
@@ -162,11 +190,11 @@ stack_list_t *stack_list_create(size_t element_size)
     }
 
     // Create underlying linked list
-    stack->list = singly_list_create(element_size);
+    stack->list = singly_list_create_with_allocator(element_size, allocator);
     if (stack->list == NULL)
     {
         fprintf(stderr, "Error: Failed to create underlying list for stack\n");
-        mem_free((void **)&stack);
+        allocator_free(allocator, stack, sizeof(stack_list_t));
         return NULL;
     }
 
@@ -177,8 +205,10 @@ void stack_list_destroy(stack_list_t *stack)
 {
     if (stack != NULL)
     {
+        // The stack structure came from the list's allocator
+        allocator_t allocator = stack->list->allocator;
         singly_list_destroy(stack->list);
-        mem_free((void **)&stack);
+        allocator_free(&allocator, stack, sizeof(stack_list_t));
     }
 }
 
@@ -233,3 +263,333 @@ bool stack_list_empty(const stack_list_t *stack)
 {
     return stack == NULL || singly_list_empty(stack->list);
 }
+
+/* ===== LOCK-FREE STACK IMPLEMENTATION ===== */
+
+/*
+ * @brief Packs a node index and an ABA tag into a head word
+ * @param index Node index + 1 (0 means empty)
+ * @param tag Update counter
+ * @return Packed head value
+ */
+static inline uint64_t stack_lockfree_pack(uint32_t index, uint32_t tag)
+{
+    return (uint64_t)index | ((uint64_t)tag << 32);
+}
+
+/*
+ * @brief Finds which chunk holds a node and where
+ * @param index Node index
+ * @param offset Receives the node's position inside the chunk
+ * @return Chunk number
+ *
+ * @note Time complexity: O(1) with GCC/Clang builtins, O(log n) otherwise
+ */
+static inline size_t stack_lockfree_chunk_of(size_t index, size_t *offset)
+{
+    if (index < STACK_LOCKFREE_FIRST_CHUNK)
+    {
+        *offset = index;
+        return 0;
+    }
+
+    // Chunk k > 0 starts at FIRST << (k - 1): k is 1 + log2(index / FIRST)
+    size_t scaled = index / STACK_LOCKFREE_FIRST_CHUNK;
+#if defined(__GNUC__)
+    size_t chunk = (sizeof(unsigned long long) * 8) -
+                   (size_t)__builtin_clzll((unsigned long long)scaled);
+#else
+    size_t chunk = 0;
+    while (scaled != 0)
+    {
+        scaled >>= 1;
+        chunk++;
+    }
+#endif
+
+    *offset = index - ((size_t)STACK_LOCKFREE_FIRST_CHUNK << (chunk - 1));
+    return chunk;
+}
+
+/*
+ * @brief Number of nodes held by a chunk
+ * @param chunk Chunk number
+ * @return Node count
+ */
+static inline size_t stack_lockfree_chunk_nodes(size_t chunk)
+{
+    return chunk == 0 ? STACK_LOCKFREE_FIRST_CHUNK
+                      : (size_t)STACK_LOCKFREE_FIRST_CHUNK << (chunk - 1);
+}
+
+/*
+ * @brief Gets the link word of a node
+ * @param stack Target stack
+ * @param index Node index (its chunk must already exist)
+ * @return Pointer to the node's next index
+ */
+static inline _Atomic(uint32_t) *stack_lockfree_node(stack_lockfree_t *stack,
+                                                     size_t index)
+{
+    size_t offset;
+    size_t chunk = stack_lockfree_chunk_of(index, &offset);
+    unsigned char *base =
+        atomic_load_explicit(&stack->chunks[chunk], memory_order_acquire);
+    return (_Atomic(uint32_t) *)(base + offset * stack->node_size);
+}
+
+/*
+ * @brief Gets the element storage of a node
+ * @param node Node link word
+ * @return Pointer to the element bytes
+ */
+static inline unsigned char *stack_lockfree_data(_Atomic(uint32_t) *node)
+{
+    return (unsigned char *)node + STACK_LOCKFREE_DATA_OFFSET;
+}
+
+/*
+ * @brief Links a node onto a tagged list head
+ * @param stack Stack owning the node
+ * @param head Head to push onto (stack head or free list)
+ * @param index Node index
+ *
+ * @note Release makes the node's contents visible to whoever pops it
+ */
+static void stack_lockfree_link(stack_lockfree_t *stack,
+                                _Atomic(uint64_t) *head, size_t index)
+{
+    _Atomic(uint32_t) *node = stack_lockfree_node(stack, index);
+    uint64_t old = atomic_load_explicit(head, memory_order_relaxed);
+    uint64_t desired;
+
+    do
+    {
+        atomic_store_explicit(node, (uint32_t)old, memory_order_relaxed);
+        desired = stack_lockfree_pack((uint32_t)(index + 1),
+                                      (uint32_t)(old >> 32) + 1);
+    } while (!atomic_compare_exchange_weak_explicit(
+        head, &old, desired, memory_order_release, memory_order_relaxed));
+}
+
+/*
+ * @brief Unlinks the top node from a tagged list head
+ * @param stack Stack owning the nodes
+ * @param head Head to pop from (stack head or free list)
+ * @param index Receives the node index
+ * @return true if a node was unlinked, false if the list was empty
+ *
+ * @note The tag makes the CAS fail if the top node was popped and pushed
+ * back in between, even though its index is unchanged
+ */
+static bool stack_lockfree_unlink(stack_lockfree_t *stack,
+                                  _Atomic(uint64_t) *head, size_t *index)
+{
+    uint64_t old = atomic_load_explicit(head, memory_order_acquire);
+    uint64_t desired;
+
+    do
+    {
+        uint32_t top = (uint32_t)old;
+        if (top == 0)
+        {
+            return false;
+        }
+
+        // The node may be recycled under us; the tagged CAS rejects that
+        uint32_t next = atomic_load_explicit(
+            stack_lockfree_node(stack, top - 1), memory_order_relaxed);
+        desired = stack_lockfree_pack(next, (uint32_t)(old >> 32) + 1);
+    } while (!atomic_compare_exchange_weak_explicit(
+        head, &old, desired, memory_order_acquire, memory_order_acquire));
+
+    *index = (uint32_t)old - 1;
+    return true;
+}
+
+/*
+ * @brief Takes a node for a push, from the free list or fresh storage
+ * @param stack Target stack
+ * @param index Receives the node index
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note The first thread to need a chunk allocates it; losers of the
+ * publishing CAS free their copy
+ */
+static status_t stack_lockfree_acquire_node(stack_lockfree_t *stack,
+                                            size_t *index)
+{
+    if (stack_lockfree_unlink(stack, &stack->free_list, index))
+    {
+        return SUCCESS;
+    }
+
+    size_t fresh =
+        atomic_fetch_add_explicit(&stack->next_unused, 1, memory_order_relaxed);
+    if (fresh >= STACK_LOCKFREE_MAX_NODES)
+    {
+        fprintf(stderr, "Error: Lock-free stack node limit reached\n");
+        return ERROR_FULL_CONTAINER;
+    }
+
+    size_t offset;
+    size_t chunk = stack_lockfree_chunk_of(fresh, &offset);
+    if (atomic_load_explicit(&stack->chunks[chunk], memory_order_acquire) ==
+        NULL)
+    {
+        size_t bytes = stack_lockfree_chunk_nodes(chunk) * stack->node_size;
+        unsigned char *block =
+            (unsigned char *)allocator_alloc(&stack->allocator, bytes);
+        if (block == NULL)
+        {
+            fprintf(stderr,
+                    "Error: Failed to allocate stack chunk of size %zu\n",
+                    bytes);
+            return ERROR_MEMORY_ALLOCATION;
+        }
+
+        unsigned char *expected = NULL;
+        if (!atomic_compare_exchange_strong_explicit(
+                &stack->chunks[chunk], &expected, block, memory_order_acq_rel,
+                memory_order_acquire))
+        {
+            allocator_free(&stack->allocator, block, bytes);
+        }
+    }
+
+    *index = fresh;
+    return SUCCESS;
+}
+
+stack_lockfree_t *stack_lockfree_create(size_t element_size)
+{
+    return stack_lockfree_create_with_allocator(element_size, NULL);
+}
+
+stack_lockfree_t *stack_lockfree_create_with_allocator(
+    size_t element_size, const allocator_t *allocator)
+{
+    // Validate input parameters
+    if (element_size == 0)
+    {
+        fprintf(stderr, "Error: Cannot create stack with element size 0\n");
+        return NULL;
+    }
+
+    if (allocator == NULL)
+    {
+        allocator = allocator_default();
+    }
+
+    // Allocate stack structure
+    stack_lockfree_t *stack = (stack_lockfree_t *)allocator_alloc(
+        allocator, sizeof(stack_lockfree_t));
+    if (stack == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate stack structure\n");
+        return NULL;
+    }
+
+    // Nodes are rounded so every link word stays aligned
+    size_t align = STACK_LOCKFREE_DATA_OFFSET;
+    stack->element_size = element_size;
+    stack->node_size =
+        (STACK_LOCKFREE_DATA_OFFSET + element_size + align - 1) & ~(align - 1);
+    stack->allocator = *allocator;
+
+    for (size_t i = 0; i < STACK_LOCKFREE_MAX_CHUNKS; i++)
+    {
+        atomic_init(&stack->chunks[i], NULL);
+    }
+    atomic_init(&stack->head, 0);
+    atomic_init(&stack->free_list, 0);
+    atomic_init(&stack->next_unused, 0);
+
+    return stack;
+}
+
+void stack_lockfree_destroy(stack_lockfree_t *stack)
+{
+    if (stack == NULL)
+    {
+        return;
+    }
+
+    // Copy the allocator out: it lives inside the block being freed
+    allocator_t allocator = stack->allocator;
+
+    for (size_t i = 0; i < STACK_LOCKFREE_MAX_CHUNKS; i++)
+    {
+        unsigned char *chunk =
+            atomic_load_explicit(&stack->chunks[i], memory_order_relaxed);
+        if (chunk != NULL)
+        {
+            allocator_free(&allocator, chunk,
+                           stack_lockfree_chunk_nodes(i) * stack->node_size);
+        }
+    }
+
+    allocator_free(&allocator, stack, sizeof(stack_lockfree_t));
+}
+
+status_t stack_lockfree_push(stack_lockfree_t *stack, const void *element)
+{
+    // Validate input parameters
+    if (stack == NULL || element == NULL)
+    {
+        fprintf(stderr, "Error: Invalid input parameters for stack push\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    size_t index;
+    status_t result = stack_lockfree_acquire_node(stack, &index);
+    if (result != SUCCESS)
+    {
+        return result;
+    }
+
+    // The node is private until linked, so a plain copy is enough
+    mem_copy(stack_lockfree_data(stack_lockfree_node(stack, index)), element,
+             stack->element_size);
+    stack_lockfree_link(stack, &stack->head, index);
+
+    return SUCCESS;
+}
+
+status_t stack_lockfree_pop(stack_lockfree_t *stack, void *output)
+{
+    // Validate input parameters
+    if (stack == NULL)
+    {
+        fprintf(stderr, "Error: Invalid stack pointer for pop operation\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    size_t index;
+    if (!stack_lockfree_unlink(stack, &stack->head, &index))
+    {
+        return ERROR_EMPTY_CONTAINER;
+    }
+
+    if (output != NULL)
+    {
+        mem_copy(output, stack_lockfree_data(stack_lockfree_node(stack, index)),
+                 stack->element_size);
+    }
+
+    stack_lockfree_link(stack, &stack->free_list, index);
+
+    return SUCCESS;
+}
+
+bool stack_lockfree_empty(const stack_lockfree_t *stack)
+{
+    if (stack == NULL)
+    {
+        return true;
+    }
+
+    // atomic_load does not accept const-qualified objects in C11
+    stack_lockfree_t *s = (stack_lockfree_t *)stack;
+    return (uint32_t)atomic_load_explicit(&s->head, memory_order_acquire) == 0;
+}
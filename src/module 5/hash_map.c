@@ -0,0 +1,691 @@
+/*
+ * @file hash_map.c
+ * @brief Implementation of Hash Map Data Structure (Swiss Table)
+ * @author Rodrigo Martins
+ * @version 0.0
+ * @date 2024
+ *
+ * CStructs+ Library - Hash Map Module
+ * Provides an open-addressing hash map with SIMD group probing
+ */
+
+#include "../../include/module 5/hash_map.h"
+#include <stdio.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define HASH_MAP_USE_SSE2 1
+#else
+#define HASH_MAP_USE_SSE2 0
+#endif
+
+/* ===== CONSTANTS ===== */
+
+// Control byte values; full slots hold a 7-bit tag in 0..127
+#define HASH_MAP_CTRL_EMPTY ((int8_t)-128)
+#define HASH_MAP_CTRL_DELETED ((int8_t)-2)
+
+#define HASH_MAP_MIN_CAPACITY HASH_MAP_GROUP_WIDTH
+
+/* ===== HELPER FUNCTIONS ===== */
+
+/*
+ * @brief Maximum number of entries (including tombstones) for a capacity
+ * @param capacity Table capacity
+ * @return Capacity minus one eighth
+ */
+static inline size_t hash_map_max_load(size_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+/*
+ * @brief Natural alignment for an element of the given size
+ * @param size Element size in bytes
+ * @return Largest power of two dividing size, capped at max_align_t
+ */
+static inline size_t hash_map_alignment(size_t size)
+{
+    size_t align = size & (~size + 1);
+    if (align == 0 || align > _Alignof(max_align_t))
+    {
+        align = _Alignof(max_align_t);
+    }
+    return align;
+}
+
+/*
+ * @brief Index of the lowest set bit of a non-zero group mask
+ * @param mask Bit mask
+ * @return Bit index
+ */
+static inline unsigned hash_map_ctz(uint32_t mask)
+{
+#if defined(__GNUC__)
+    return (unsigned)__builtin_ctz(mask);
+#else
+    unsigned count = 0;
+    while ((mask & 1) == 0)
+    {
+        mask >>= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+/*
+ * @brief Number of leading zeros of a 16-bit group mask
+ * @param mask Bit mask (upper 16 bits clear)
+ * @return Zeros above the highest set bit, 16 for an empty mask
+ */
+static inline unsigned hash_map_clz16(uint32_t mask)
+{
+#if defined(__GNUC__)
+    if (mask == 0)
+    {
+        return HASH_MAP_GROUP_WIDTH;
+    }
+    return (unsigned)__builtin_clz(mask) - (32 - HASH_MAP_GROUP_WIDTH);
+#else
+    unsigned count = 0;
+    uint32_t bit = 1u << (HASH_MAP_GROUP_WIDTH - 1);
+    while (bit != 0 && (mask & bit) == 0)
+    {
+        bit >>= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+/* ===== GROUP MATCHING ===== */
+
+/*
+ * @brief Finds control bytes in a group equal to a tag
+ * @param group First of HASH_MAP_GROUP_WIDTH control bytes
+ * @param tag Value to look for
+ * @return Bit i set when group[i] == tag
+ *
+ * @note One compare and one movemask with SSE2
+ */
+static inline uint32_t hash_map_group_match(const int8_t *group, int8_t tag)
+{
+#if HASH_MAP_USE_SSE2
+    __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+    return (uint32_t)_mm_movemask_epi8(
+        _mm_cmpeq_epi8(ctrl, _mm_set1_epi8(tag)));
+#else
+    uint32_t mask = 0;
+    for (unsigned i = 0; i < HASH_MAP_GROUP_WIDTH; i++)
+    {
+        mask |= (uint32_t)(group[i] == tag) << i;
+    }
+    return mask;
+#endif
+}
+
+/*
+ * @brief Finds empty or deleted control bytes in a group
+ * @param group First of HASH_MAP_GROUP_WIDTH control bytes
+ * @return Bit i set when group[i] is not a full slot
+ *
+ * @note Both markers are negative, so this is just the sign bits
+ */
+static inline uint32_t hash_map_group_match_free(const int8_t *group)
+{
+#if HASH_MAP_USE_SSE2
+    return (uint32_t)_mm_movemask_epi8(
+        _mm_loadu_si128((const __m128i *)group));
+#else
+    uint32_t mask = 0;
+    for (unsigned i = 0; i < HASH_MAP_GROUP_WIDTH; i++)
+    {
+        mask |= (uint32_t)(group[i] < 0) << i;
+    }
+    return mask;
+#endif
+}
+
+/* ===== TABLE HELPERS ===== */
+
+/*
+ * @brief Gets the address of a slot
+ * @param map Target map
+ * @param index Slot index
+ * @return Pointer to the slot's key
+ */
+static inline unsigned char *hash_map_slot(const hash_map_t *map, size_t index)
+{
+    return map->slots + index * map->slot_size;
+}
+
+/*
+ * @brief Writes a control byte and its mirror
+ * @param ctrl Control array
+ * @param capacity Table capacity
+ * @param index Slot index
+ * @param value New control byte
+ */
+static inline void hash_map_set_ctrl(int8_t *ctrl, size_t capacity,
+                                     size_t index, int8_t value)
+{
+    ctrl[index] = value;
+    if (index < HASH_MAP_GROUP_WIDTH)
+    {
+        ctrl[capacity + index] = value;
+    }
+}
+
+/*
+ * @brief Bytes needed for the control array, padded for slot alignment
+ * @param capacity Table capacity
+ * @return Control array size in bytes
+ */
+static inline size_t hash_map_ctrl_bytes(size_t capacity)
+{
+    size_t align = _Alignof(max_align_t);
+    return (capacity + HASH_MAP_GROUP_WIDTH + align - 1) & ~(align - 1);
+}
+
+/*
+ * @brief Finds the first free slot on a key's probe sequence
+ * @param ctrl Control array
+ * @param capacity Table capacity
+ * @param hash Key hash
+ * @return Slot index
+ *
+ * @note The table is never full, so a free slot always exists
+ */
+static size_t hash_map_find_free(const int8_t *ctrl, size_t capacity,
+                                 uint64_t hash)
+{
+    size_t mask = capacity - 1;
+    size_t pos = (size_t)(hash >> 7) & mask;
+    size_t stride = 0;
+
+    for (;;)
+    {
+        uint32_t free_mask = hash_map_group_match_free(ctrl + pos);
+        if (free_mask != 0)
+        {
+            return (pos + hash_map_ctz(free_mask)) & mask;
+        }
+
+        // Triangular steps of whole groups visit every group once
+        stride += HASH_MAP_GROUP_WIDTH;
+        pos = (pos + stride) & mask;
+    }
+}
+
+/*
+ * @brief Finds the slot holding a key
+ * @param map Target map
+ * @param key Key to look up
+ * @param hash Hash of key
+ * @param index Receives the slot index when found
+ * @return true if found, false otherwise
+ *
+ * @note Stops at the first group containing an empty slot: an insert for
+ * this key would have used it
+ */
+static bool hash_map_find(const hash_map_t *map, const void *key,
+                          uint64_t hash, size_t *index)
+{
+    size_t mask = map->capacity - 1;
+    size_t pos = (size_t)(hash >> 7) & mask;
+    size_t stride = 0;
+    int8_t tag = (int8_t)(hash & 0x7F);
+
+    for (;;)
+    {
+        const int8_t *group = map->ctrl + pos;
+
+        uint32_t match = hash_map_group_match(group, tag);
+        while (match != 0)
+        {
+            size_t candidate = (pos + hash_map_ctz(match)) & mask;
+            if (map->cmp(hash_map_slot(map, candidate), key) == 0)
+            {
+                *index = candidate;
+                return true;
+            }
+            match &= match - 1;
+        }
+
+        if (hash_map_group_match(group, HASH_MAP_CTRL_EMPTY) != 0)
+        {
+            return false;
+        }
+
+        stride += HASH_MAP_GROUP_WIDTH;
+        pos = (pos + stride) & mask;
+    }
+}
+
+/*
+ * @brief Rebuilds the table at a new capacity
+ * @param map Target map
+ * @param new_capacity New capacity (power of two, >= minimum)
+ * @return SUCCESS on success, error code on failure
+ *
+ * @note Time complexity: O(n + capacity)
+ * @note Drops every tombstone
+ */
+static status_t hash_map_rehash(hash_map_t *map, size_t new_capacity)
+{
+    size_t ctrl_bytes = hash_map_ctrl_bytes(new_capacity);
+    size_t total = ctrl_bytes + new_capacity * map->slot_size;
+
+    unsigned char *block =
+        (unsigned char *)allocator_alloc(&map->allocator, total);
+    if (block == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate hash table of size %zu\n",
+                total);
+        return ERROR_MEMORY_ALLOCATION;
+    }
+
+    int8_t *new_ctrl = (int8_t *)block;
+    unsigned char *new_slots = block + ctrl_bytes;
+    mem_set(new_ctrl, (unsigned char)HASH_MAP_CTRL_EMPTY,
+            new_capacity + HASH_MAP_GROUP_WIDTH);
+
+    // Move every live entry; keys are re-hashed, values copied with them
+    for (size_t i = 0; i < map->capacity; i++)
+    {
+        if (map->ctrl[i] < 0)
+        {
+            continue;
+        }
+
+        const unsigned char *slot = hash_map_slot(map, i);
+        uint64_t hash = map->hash(slot);
+        size_t target = hash_map_find_free(new_ctrl, new_capacity, hash);
+
+        hash_map_set_ctrl(new_ctrl, new_capacity, target,
+                          (int8_t)(hash & 0x7F));
+        mem_copy(new_slots + target * map->slot_size, slot, map->slot_size);
+    }
+
+    if (map->ctrl != NULL)
+    {
+        allocator_free(&map->allocator, map->ctrl,
+                       hash_map_ctrl_bytes(map->capacity) +
+                           map->capacity * map->slot_size);
+    }
+
+    map->ctrl = new_ctrl;
+    map->slots = new_slots;
+    map->capacity = new_capacity;
+    map->growth_left = hash_map_max_load(new_capacity) - map->size;
+
+    return SUCCESS;
+}
+
+/* ===== HASH MAP IMPLEMENTATION ===== */
+
+hash_map_t *hash_map_create(size_t key_size, size_t value_size, hash_fn hash,
+                            cmp_fn cmp)
+{
+    return hash_map_create_with_allocator(key_size, value_size, hash, cmp,
+                                          NULL);
+}
+
+hash_map_t *hash_map_create_with_allocator(size_t key_size, size_t value_size,
+                                           hash_fn hash, cmp_fn cmp,
+                                           const allocator_t *allocator)
+{
+    // Validate input parameters
+    if (key_size == 0 || hash == NULL || cmp == NULL)
+    {
+        fprintf(stderr, "Error: Invalid parameters for hash map creation\n");
+        return NULL;
+    }
+
+    if (allocator == NULL)
+    {
+        allocator = allocator_default();
+    }
+
+    // Allocate map structure
+    hash_map_t *map =
+        (hash_map_t *)allocator_alloc(allocator, sizeof(hash_map_t));
+    if (map == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate hash map structure\n");
+        return NULL;
+    }
+
+    // Lay out key then value, each at its natural alignment
+    size_t key_align = hash_map_alignment(key_size);
+    size_t value_align = value_size > 0 ? hash_map_alignment(value_size) : 1;
+    size_t slot_align = key_align > value_align ? key_align : value_align;
+
+    map->key_size = key_size;
+    map->value_size = value_size;
+    map->value_offset = (key_size + value_align - 1) & ~(value_align - 1);
+    map->slot_size = (map->value_offset + value_size + slot_align - 1) &
+                     ~(slot_align - 1);
+    map->hash = hash;
+    map->cmp = cmp;
+    map->allocator = *allocator;
+    map->ctrl = NULL;
+    map->slots = NULL;
+    map->capacity = 0;
+    map->size = 0;
+    map->growth_left = 0;
+
+    if (hash_map_rehash(map, HASH_MAP_MIN_CAPACITY) != SUCCESS)
+    {
+        allocator_free(allocator, map, sizeof(hash_map_t));
+        return NULL;
+    }
+
+    return map;
+}
+
+void hash_map_destroy(hash_map_t *map)
+{
+    if (map != NULL)
+    {
+        // Copy the allocator out: it lives inside the block being freed
+        allocator_t allocator = map->allocator;
+        allocator_free(&allocator, map->ctrl,
+                       hash_map_ctrl_bytes(map->capacity) +
+                           map->capacity * map->slot_size);
+        allocator_free(&allocator, map, sizeof(hash_map_t));
+    }
+}
+
+status_t hash_map_insert(hash_map_t *map, const void *key, const void *value)
+{
+    // Validate input parameters
+    if (map == NULL || key == NULL || (value == NULL && map->value_size > 0))
+    {
+        fprintf(stderr,
+                "Error: Invalid input parameters for hash map insert\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    uint64_t hash = map->hash(key);
+    size_t index;
+
+    // Existing key: overwrite the value in place
+    if (hash_map_find(map, key, hash, &index))
+    {
+        mem_copy(hash_map_slot(map, index) + map->value_offset, value,
+                 map->value_size);
+        return SUCCESS;
+    }
+
+    index = hash_map_find_free(map->ctrl, map->capacity, hash);
+
+    // Only claiming an empty slot uses up growth; tombstones are free
+    if (map->growth_left == 0 && map->ctrl[index] == HASH_MAP_CTRL_EMPTY)
+    {
+        // Mostly tombstones: rebuild in place; otherwise double
+        size_t new_capacity = map->capacity;
+        if (map->size * 2 > hash_map_max_load(map->capacity))
+        {
+            new_capacity = map->capacity * 2;
+        }
+
+        status_t result = hash_map_rehash(map, new_capacity);
+        if (result != SUCCESS)
+        {
+            return result;
+        }
+
+        index = hash_map_find_free(map->ctrl, map->capacity, hash);
+    }
+
+    if (map->ctrl[index] == HASH_MAP_CTRL_EMPTY)
+    {
+        map->growth_left--;
+    }
+
+    unsigned char *slot = hash_map_slot(map, index);
+    mem_copy(slot, key, map->key_size);
+    if (map->value_size > 0)
+    {
+        mem_copy(slot + map->value_offset, value, map->value_size);
+    }
+    hash_map_set_ctrl(map->ctrl, map->capacity, index, (int8_t)(hash & 0x7F));
+    map->size++;
+
+    return SUCCESS;
+}
+
+status_t hash_map_get(const hash_map_t *map, const void *key, void *value)
+{
+    // Validate input parameters
+    if (map == NULL || key == NULL)
+    {
+        fprintf(stderr, "Error: Invalid input parameters for hash map get\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    size_t index;
+    if (!hash_map_find(map, key, map->hash(key), &index))
+    {
+        return ERROR_NOT_FOUND;
+    }
+
+    if (value != NULL && map->value_size > 0)
+    {
+        mem_copy(value, hash_map_slot(map, index) + map->value_offset,
+                 map->value_size);
+    }
+
+    return SUCCESS;
+}
+
+void *hash_map_get_ref(const hash_map_t *map, const void *key)
+{
+    if (map == NULL || key == NULL)
+    {
+        return NULL;
+    }
+
+    size_t index;
+    if (!hash_map_find(map, key, map->hash(key), &index))
+    {
+        return NULL;
+    }
+
+    return hash_map_slot(map, index) + map->value_offset;
+}
+
+bool hash_map_contains(const hash_map_t *map, const void *key)
+{
+    size_t index;
+    return map != NULL && key != NULL &&
+           hash_map_find(map, key, map->hash(key), &index);
+}
+
+/*
+ * @brief Frees the slot at index
+ * @param map Target map
+ * @param index Slot index of a full slot
+ *
+ * @note A slot can become empty again when the groups just before and just
+ * after it have an empty slot close enough that no 16-wide window through
+ * this slot was ever completely full, so no probe can have passed it
+ */
+static void hash_map_erase_at(hash_map_t *map, size_t index)
+{
+    size_t mask = map->capacity - 1;
+    size_t before = (index - HASH_MAP_GROUP_WIDTH) & mask;
+
+    uint32_t empty_after =
+        hash_map_group_match(map->ctrl + index, HASH_MAP_CTRL_EMPTY);
+    uint32_t empty_before =
+        hash_map_group_match(map->ctrl + before, HASH_MAP_CTRL_EMPTY);
+
+    bool was_never_full =
+        empty_before != 0 && empty_after != 0 &&
+        hash_map_ctz(empty_after) + hash_map_clz16(empty_before) <
+            HASH_MAP_GROUP_WIDTH;
+
+    if (was_never_full)
+    {
+        hash_map_set_ctrl(map->ctrl, map->capacity, index,
+                          HASH_MAP_CTRL_EMPTY);
+        map->growth_left++;
+    }
+    else
+    {
+        hash_map_set_ctrl(map->ctrl, map->capacity, index,
+                          HASH_MAP_CTRL_DELETED);
+    }
+
+    map->size--;
+}
+
+status_t hash_map_erase(hash_map_t *map, const void *key)
+{
+    // Validate input parameters
+    if (map == NULL || key == NULL)
+    {
+        fprintf(stderr, "Error: Invalid input parameters for hash map erase\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    size_t index;
+    if (!hash_map_find(map, key, map->hash(key), &index))
+    {
+        return ERROR_NOT_FOUND;
+    }
+
+    hash_map_erase_at(map, index);
+    return SUCCESS;
+}
+
+status_t hash_map_reserve(hash_map_t *map, size_t count)
+{
+    if (map == NULL)
+    {
+        fprintf(stderr, "Error: Invalid map pointer for reserve operation\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    // Enough room already without touching tombstones
+    if (count <= map->size + map->growth_left)
+    {
+        return SUCCESS;
+    }
+
+    size_t capacity = next_power_of_two(count + count / 7 + 1);
+    if (capacity == 0)
+    {
+        fprintf(stderr, "Error: Hash map capacity too large\n");
+        return ERROR_MEMORY_ALLOCATION;
+    }
+    while (hash_map_max_load(capacity) < count)
+    {
+        capacity *= 2;
+    }
+    if (capacity < map->capacity)
+    {
+        capacity = map->capacity;
+    }
+
+    return hash_map_rehash(map, capacity);
+}
+
+void hash_map_clear(hash_map_t *map)
+{
+    if (map != NULL)
+    {
+        mem_set(map->ctrl, (unsigned char)HASH_MAP_CTRL_EMPTY,
+                map->capacity + HASH_MAP_GROUP_WIDTH);
+        map->size = 0;
+        map->growth_left = hash_map_max_load(map->capacity);
+    }
+}
+
+size_t hash_map_size(const hash_map_t *map)
+{
+    return map != NULL ? map->size : 0;
+}
+
+bool hash_map_empty(const hash_map_t *map)
+{
+    return map == NULL || map->size == 0;
+}
+
+size_t hash_map_capacity(const hash_map_t *map)
+{
+    return map != NULL ? map->capacity : 0;
+}
+
+/* ===== ITERATION ===== */
+
+/*
+ * @brief Advances an index to the next full slot
+ * @param map Target map
+ * @param index Slot to start from
+ * @return Index of the next full slot, capacity if none
+ */
+static size_t hash_map_next_full(const hash_map_t *map, size_t index)
+{
+    while (index < map->capacity && map->ctrl[index] < 0)
+    {
+        index++;
+    }
+    return index;
+}
+
+hash_map_iter_t hash_map_iter_create(hash_map_t *map)
+{
+    hash_map_iter_t iter;
+    iter.map = map;
+    iter.index = map != NULL ? hash_map_next_full(map, 0) : 0;
+    iter.last = map != NULL ? map->capacity : 0;
+    return iter;
+}
+
+bool hash_map_iter_has_next(const hash_map_iter_t *iter)
+{
+    return iter != NULL && iter->map != NULL &&
+           iter->index < iter->map->capacity;
+}
+
+status_t hash_map_iter_next(hash_map_iter_t *iter, void *key, void *value)
+{
+    if (!hash_map_iter_has_next(iter))
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    const hash_map_t *map = iter->map;
+    const unsigned char *slot = hash_map_slot(map, iter->index);
+
+    if (key != NULL)
+    {
+        mem_copy(key, slot, map->key_size);
+    }
+    if (value != NULL && map->value_size > 0)
+    {
+        mem_copy(value, slot + map->value_offset, map->value_size);
+    }
+
+    iter->last = iter->index;
+    iter->index = hash_map_next_full(map, iter->index + 1);
+    return SUCCESS;
+}
+
+status_t hash_map_iter_remove(hash_map_iter_t *iter)
+{
+    if (iter == NULL || iter->map == NULL ||
+        iter->last >= iter->map->capacity ||
+        iter->map->ctrl[iter->last] < 0)
+    {
+        return ERROR_INVALID_INPUT; // Nothing returned yet, or already removed
+    }
+
+    hash_map_erase_at(iter->map, iter->last);
+    iter->last = iter->map->capacity;
+    return SUCCESS;
+}
@@ -0,0 +1,417 @@
+/*
+ * @file timer_wheel.c
+ * @brief Implementation of Hierarchical Timing Wheel
+ * @author Rodrigo Martins
+ * @version 0.0
+ * @date 2024
+ *
+ * CStructs+ Library - Timer Module
+ * Provides O(1) timer scheduling and cancellation for large timeout sets
+ */
+
+#include "../../include/module 6/timer_wheel.h"
+#include <stdio.h>
+
+/* ===== CONSTANTS ===== */
+
+// Payload offset inside a timer's node data; keeps it malloc-aligned
+#define TIMER_WHEEL_PAYLOAD_OFFSET _Alignof(max_align_t)
+
+// Delays at or beyond this many ticks park in the top level
+#define TIMER_WHEEL_HORIZON \
+    ((uint64_t)1 << (TIMER_WHEEL_SLOT_BITS * TIMER_WHEEL_LEVELS))
+
+// Bucket holding the batch that is currently firing
+#define TIMER_WHEEL_FIRING (TIMER_WHEEL_BUCKETS - 1)
+
+// Bucket value of the timer whose callback is running
+#define TIMER_WHEEL_DETACHED ((size_t)-1)
+
+/* ===== HELPER FUNCTIONS ===== */
+
+/*
+ * @brief Bookkeeping stored ahead of the payload in every timer node
+ */
+typedef struct
+{
+        uint64_t expires; // Absolute expiry tick
+        size_t bucket;    // Bucket list holding the node
+} timer_wheel_entry_t;
+
+_Static_assert(sizeof(timer_wheel_entry_t) <= TIMER_WHEEL_PAYLOAD_OFFSET,
+               "timer entry header overlaps the payload");
+
+/*
+ * @brief Gets the bookkeeping header of a timer
+ * @param timer Target timer
+ * @return Pointer to the header
+ */
+static inline timer_wheel_entry_t *timer_wheel_entry(timer_wheel_timer_t *timer)
+{
+    return (timer_wheel_entry_t *)timer->data;
+}
+
+/*
+ * @brief Picks the bucket for an expiry tick
+ * @param expires Absolute expiry tick, not before ref
+ * @param ref First tick the bucket may be processed at
+ * @return Bucket index
+ *
+ * @note Time complexity: O(levels)
+ * @note A timer at level k lands in the slot covering its expiry; the wheel
+ * reaches the start of that slot no later than the expiry itself
+ */
+static size_t timer_wheel_bucket_for(uint64_t expires, uint64_t ref)
+{
+    uint64_t delta = expires - ref;
+    if (delta >= TIMER_WHEEL_HORIZON)
+    {
+        // Park in the furthest top-level slot and re-file when it comes due
+        expires = ref + TIMER_WHEEL_HORIZON - 1;
+        delta = TIMER_WHEEL_HORIZON - 1;
+    }
+
+    size_t level = 0;
+    while (level + 1 < TIMER_WHEEL_LEVELS &&
+           delta >> (TIMER_WHEEL_SLOT_BITS * (level + 1)) != 0)
+    {
+        level++;
+    }
+
+    size_t slot = (size_t)(expires >> (TIMER_WHEEL_SLOT_BITS * level)) &
+                  (TIMER_WHEEL_SLOTS - 1);
+    return level * TIMER_WHEEL_SLOTS + slot;
+}
+
+/*
+ * @brief Moves a timer to the bucket its expiry calls for
+ * @param wheel Target wheel
+ * @param timer Timer to file
+ * @param ref First tick the bucket may be processed at
+ *
+ * @note Time complexity: O(1)
+ * @warning timer must be linked into the bucket its entry names
+ */
+static void timer_wheel_refile(timer_wheel_t *wheel,
+                               timer_wheel_timer_t *timer, uint64_t ref)
+{
+    timer_wheel_entry_t *entry = timer_wheel_entry(timer);
+    size_t bucket = timer_wheel_bucket_for(entry->expires, ref);
+
+    doubly_list_move_node_back(wheel->buckets[bucket],
+                               wheel->buckets[entry->bucket], timer);
+    entry->bucket = bucket;
+}
+
+/*
+ * @brief Redistributes one higher-level slot into the levels below it
+ * @param wheel Target wheel
+ * @param level Level of the slot (at least 1)
+ * @param tick Tick being processed, the start of the slot's span
+ *
+ * @note Time complexity: O(m) where m is the number of timers in the slot
+ * @note Every timer lands strictly below level, so the slot never refills
+ * while it is being walked
+ */
+static void timer_wheel_cascade(timer_wheel_t *wheel, size_t level,
+                                uint64_t tick)
+{
+    size_t slot = (size_t)(tick >> (TIMER_WHEEL_SLOT_BITS * level)) &
+                  (TIMER_WHEEL_SLOTS - 1);
+    doubly_list_t *bucket = wheel->buckets[level * TIMER_WHEEL_SLOTS + slot];
+
+    while (bucket->head != NULL)
+    {
+        timer_wheel_refile(wheel, bucket->head, tick);
+    }
+}
+
+/*
+ * @brief Fires every timer in the level-0 slot for a tick
+ * @param wheel Target wheel
+ * @param tick Tick being processed
+ * @param callback Function called for each timer (may be NULL)
+ * @param context Pointer passed through to the callback
+ * @return Number of timers fired
+ */
+static size_t timer_wheel_fire(timer_wheel_t *wheel, uint64_t tick,
+                               timer_wheel_fn callback, void *context)
+{
+    doubly_list_t *slot =
+        wheel->buckets[(size_t)tick & (TIMER_WHEEL_SLOTS - 1)];
+    if (slot->head == NULL)
+    {
+        return 0;
+    }
+
+    // Detach the batch so timers added by callbacks wait for a later tick
+    doubly_list_t *firing = wheel->buckets[TIMER_WHEEL_FIRING];
+    doubly_list_splice_back(firing, slot);
+    for (doubly_node_t *node = firing->head; node != NULL; node = node->next)
+    {
+        timer_wheel_entry(node)->bucket = TIMER_WHEEL_FIRING;
+    }
+
+    size_t fired = 0;
+    while (firing->head != NULL)
+    {
+        timer_wheel_timer_t *timer = firing->head;
+        timer_wheel_entry_t *entry = timer_wheel_entry(timer);
+        entry->bucket = TIMER_WHEEL_DETACHED;
+
+        if (callback != NULL)
+        {
+            callback(timer, timer->data + TIMER_WHEEL_PAYLOAD_OFFSET, context);
+        }
+        fired++;
+
+        // A callback that rescheduled the timer has already moved it
+        if (entry->bucket == TIMER_WHEEL_DETACHED)
+        {
+            doubly_list_erase_node(firing, timer);
+            wheel->size--;
+        }
+    }
+
+    return fired;
+}
+
+/* ===== TIMER WHEEL CREATION AND DESTRUCTION ===== */
+
+timer_wheel_t *timer_wheel_create(size_t payload_size)
+{
+    return timer_wheel_create_with_allocator(payload_size, NULL);
+}
+
+timer_wheel_t *timer_wheel_create_with_allocator(size_t payload_size,
+                                                 const allocator_t *allocator)
+{
+    if (allocator == NULL)
+    {
+        allocator = allocator_default();
+    }
+
+    timer_wheel_t *wheel =
+        (timer_wheel_t *)allocator_alloc(allocator, sizeof(timer_wheel_t));
+    if (wheel == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate timer wheel structure\n");
+        return NULL;
+    }
+
+    size_t element_size = TIMER_WHEEL_PAYLOAD_OFFSET + payload_size;
+
+    wheel->now = 0;
+    wheel->size = 0;
+    wheel->payload_size = payload_size;
+    wheel->allocator = *allocator;
+    wheel->node_pool = pool_create_with_allocator(
+        sizeof(doubly_node_t) + element_size, allocator);
+    if (wheel->node_pool == NULL)
+    {
+        fprintf(stderr, "Error: Failed to create timer wheel node pool\n");
+        allocator_free(allocator, wheel, sizeof(timer_wheel_t));
+        return NULL;
+    }
+
+    // Every bucket shares the pool so timers can move between them
+    for (size_t i = 0; i < TIMER_WHEEL_BUCKETS; i++)
+    {
+        wheel->buckets[i] =
+            doubly_list_create_with_pool(element_size, wheel->node_pool);
+        if (wheel->buckets[i] == NULL)
+        {
+            fprintf(stderr, "Error: Failed to create timer wheel bucket\n");
+            while (i-- > 0)
+            {
+                doubly_list_destroy(wheel->buckets[i]);
+            }
+            pool_destroy(wheel->node_pool);
+            allocator_free(allocator, wheel, sizeof(timer_wheel_t));
+            return NULL;
+        }
+    }
+
+    return wheel;
+}
+
+void timer_wheel_destroy(timer_wheel_t *wheel)
+{
+    if (wheel == NULL)
+        return;
+
+    for (size_t i = 0; i < TIMER_WHEEL_BUCKETS; i++)
+    {
+        doubly_list_destroy(wheel->buckets[i]);
+    }
+    pool_destroy(wheel->node_pool);
+
+    // Copy the allocator out: it lives inside the block being freed
+    allocator_t allocator = wheel->allocator;
+    allocator_free(&allocator, wheel, sizeof(timer_wheel_t));
+}
+
+/* ===== TIMER OPERATIONS ===== */
+
+timer_wheel_timer_t *timer_wheel_add(timer_wheel_t *wheel, uint64_t expires,
+                                     const void *payload)
+{
+    if (wheel == NULL || (payload == NULL && wheel->payload_size > 0))
+    {
+        fprintf(stderr, "Error: Invalid input parameters for timer add\n");
+        return NULL;
+    }
+
+    // Anything already due fires on the next tick
+    uint64_t ref = wheel->now + 1;
+    if (expires < ref)
+    {
+        expires = ref;
+    }
+
+    size_t bucket = timer_wheel_bucket_for(expires, ref);
+    timer_wheel_timer_t *timer =
+        doubly_list_push_back_node(wheel->buckets[bucket], NULL);
+    if (timer == NULL)
+    {
+        return NULL;
+    }
+
+    // Header and payload share the node's data
+    timer_wheel_entry_t *entry = timer_wheel_entry(timer);
+    entry->expires = expires;
+    entry->bucket = bucket;
+    if (wheel->payload_size > 0)
+    {
+        mem_copy(timer->data + TIMER_WHEEL_PAYLOAD_OFFSET, payload,
+                 wheel->payload_size);
+    }
+    wheel->size++;
+
+    return timer;
+}
+
+status_t timer_wheel_cancel(timer_wheel_t *wheel, timer_wheel_timer_t *timer,
+                            void *payload)
+{
+    if (wheel == NULL || timer == NULL)
+    {
+        fprintf(stderr, "Error: Invalid input parameters for timer cancel\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    timer_wheel_entry_t *entry = timer_wheel_entry(timer);
+    if (entry->bucket == TIMER_WHEEL_DETACHED)
+    {
+        return ERROR_NOT_FOUND;
+    }
+
+    if (payload != NULL && wheel->payload_size > 0)
+    {
+        mem_copy(payload, timer->data + TIMER_WHEEL_PAYLOAD_OFFSET,
+                 wheel->payload_size);
+    }
+
+    doubly_list_erase_node(wheel->buckets[entry->bucket], timer);
+    wheel->size--;
+
+    return SUCCESS;
+}
+
+status_t timer_wheel_reschedule(timer_wheel_t *wheel,
+                                timer_wheel_timer_t *timer, uint64_t expires)
+{
+    if (wheel == NULL || timer == NULL)
+    {
+        fprintf(stderr,
+                "Error: Invalid input parameters for timer reschedule\n");
+        return ERROR_INVALID_INPUT;
+    }
+
+    uint64_t ref = wheel->now + 1;
+    if (expires < ref)
+    {
+        expires = ref;
+    }
+
+    timer_wheel_entry_t *entry = timer_wheel_entry(timer);
+    entry->expires = expires;
+
+    // A running callback's timer still sits at the head of the firing list
+    if (entry->bucket == TIMER_WHEEL_DETACHED)
+    {
+        entry->bucket = TIMER_WHEEL_FIRING;
+    }
+    timer_wheel_refile(wheel, timer, ref);
+
+    return SUCCESS;
+}
+
+size_t timer_wheel_advance(timer_wheel_t *wheel, uint64_t ticks,
+                           timer_wheel_fn callback, void *context)
+{
+    if (wheel == NULL)
+    {
+        return 0;
+    }
+
+    size_t fired = 0;
+    for (uint64_t i = 0; i < ticks; i++)
+    {
+        // Nothing can come due, so skip the remaining ticks outright
+        if (wheel->size == 0)
+        {
+            wheel->now += ticks - i;
+            break;
+        }
+
+        uint64_t tick = ++wheel->now;
+
+        // Pull down each higher-level slot whose span starts at this tick
+        for (size_t level = 1; level < TIMER_WHEEL_LEVELS; level++)
+        {
+            uint64_t span_mask =
+                ((uint64_t)1 << (TIMER_WHEEL_SLOT_BITS * level)) - 1;
+            if ((tick & span_mask) != 0)
+            {
+                break;
+            }
+            timer_wheel_cascade(wheel, level, tick);
+        }
+
+        fired += timer_wheel_fire(wheel, tick, callback, context);
+    }
+
+    return fired;
+}
+
+/* ===== TIMER ACCESS ===== */
+
+void *timer_wheel_payload(timer_wheel_timer_t *timer)
+{
+    return timer != NULL ? timer->data + TIMER_WHEEL_PAYLOAD_OFFSET : NULL;
+}
+
+uint64_t timer_wheel_expires(const timer_wheel_timer_t *timer)
+{
+    return timer != NULL
+               ? ((const timer_wheel_entry_t *)timer->data)->expires
+               : 0;
+}
+
+/* ===== TIMER WHEEL PROPERTIES ===== */
+
+uint64_t timer_wheel_now(const timer_wheel_t *wheel)
+{
+    return wheel != NULL ? wheel->now : 0;
+}
+
+size_t timer_wheel_size(const timer_wheel_t *wheel)
+{
+    return wheel != NULL ? wheel->size : 0;
+}
+
+bool timer_wheel_empty(const timer_wheel_t *wheel)
+{
+    return wheel == NULL || wheel->size == 0;
+}